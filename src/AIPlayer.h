@@ -1,47 +1,62 @@
-/*!
-	@file		AIPlayer.h
-	@author		Scott
-	@date		07-14-2004
-	@brief		AI player functions. 
-*//*__________________________________________________________________________*/
-
-#ifndef __AIPLAYER_H__
-#define __AIPLAYER_H__
-
-#include "main.h"
-
-#include "game.h"
-#include "ann.h"
-#include "player.h"
-
-/*!
-	@namespace	AI
-	@author		Scott
-	@date		07-15-2004
-	@ingroup	ch
-	@brief		Contains data structures and functions related to AI.
-*//*__________________________________________________________________________*/
-
-	enum GHOST_BALL{REAL = 0, AIBALL = 1};
-
-	const float ideal_bb = 36.f / 2.25;
-	const float ideal_bp = 24.f / 2.25f;
-	const float max_len  = sqrt(float((100*100) + (50*50) + (25*25)));
-	
-	class AIPlayer : public Player
-	{
-	public:
-		AIPlayer(const std::string BPN_file, const int turn):ANN(BPN_file), TurnID(turn), FirstShot(true) {}
-		
-		virtual bool IsAI(void) const { return (true); }
-		virtual Shot SelectShot(void);
-		
-		int					TurnID;
-		AI::NeuralNet		ANN;
-		bool				FirstShot;
-	};
-
-	float convert_distance(float max, float ideal, float d);
-    D3DXVECTOR3 GhostBall(const Pocket p, int ball, GHOST_BALL type);
-	
-#endif
+/*!
+	@file		AIPlayer.h
+	@author		Scott
+	@date		07-14-2004
+	@brief		AI player functions. 
+*//*__________________________________________________________________________*/
+
+#ifndef __AIPLAYER_H__
+#define __AIPLAYER_H__
+
+#include "main.h"
+
+#include "game.h"
+#include "ann.h"
+#include "player.h"
+#include "ShotPlanner.h"
+#include "ShotSearch.h"
+
+/*!
+	@namespace	AI
+	@author		Scott
+	@date		07-15-2004
+	@ingroup	ch
+	@brief		Contains data structures and functions related to AI.
+*//*__________________________________________________________________________*/
+
+	enum GHOST_BALL{REAL = 0, AIBALL = 1};
+
+	using AI::ideal_bb;
+	using AI::ideal_bp;
+	using AI::max_len;
+	using AI::convert_distance;
+	
+	class AIPlayer : public Player
+	{
+	public:
+		AIPlayer(const std::string BPN_file, const int turn);
+		
+		virtual bool IsAI(void) const { return (true); }
+		virtual Shot SelectShot(void);
+
+		bool		BeginShot(void);
+		bool		Think(void);
+		bool		Thinking(void) const	{ return (IsThinking); }
+		Shot		TakeShot(void);
+		
+		int					TurnID;
+		AI::NeuralNet		ANN;
+		bool				FirstShot;
+		AI::ShotPlanner		Planner;		///< Candidate shots of the table being played.
+		std::vector< uint32_t >	PlannedBalls;	///< Engine id of each of Planner's balls.
+
+		AI::ShotSearch		Search;			///< Plays the best candidates out while the AI thinks.
+		AI::SearchParams	SearchSettings;	///< [AI] SearchBudget and friends in user.ini.
+		float				SearchSlice;	///< Milliseconds of thinking per frame.
+		bool				IsThinking;
+		Shot				Planned;		///< SelectShot()'s pick, taken if the search plays nothing out.
+	};
+
+    D3DXVECTOR3 GhostBall(const Pocket p, int ball, GHOST_BALL type);
+	
+#endif
@@ -0,0 +1,625 @@
+/*!
+	@file	BodyStore.cpp
+	@date	October 17, 2026
+
+	@brief	Contiguous storage for rigid body state.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include "BodyStore.h"
+#include "RigidBody.h"
+#include "SimdVector.h"
+
+static void CapVectorNorm(Geometry::Vector3D &v, float max)
+{
+	Physics::Vec3f w = Physics::Vec3f::Load(v);
+	if(w.Length() > max)
+		(max * w.Normal()).Store(v);
+}
+
+namespace Physics
+{
+const uint32_t BodyStore::kIndexBits;
+const uint32_t BodyStore::kIndexMask;
+const uint32_t BodyStore::kInvalid;
+const uint32_t BodyStore::kNoIndex;
+
+/*!
+ @return
+*//*__________________________________________________________________________*/
+BodyStore::BodyStore() : mRevision(0), mCopySource(0), mCopySourceRevision(0), mCopyRevision(0)
+{
+}
+/*!
+ @return
+*//*__________________________________________________________________________*/
+BodyStore::~BodyStore()
+{
+	Clear();
+}
+
+/*!
+ @param void
+ @return The handle of a new body with default state.
+*//*__________________________________________________________________________*/
+uint32_t BodyStore::Create(void)
+{
+	uint32_t slot;
+	if(!mFreeSlots.empty())
+	{
+		slot = mFreeSlots.back();
+		mFreeSlots.pop_back();
+	}
+	else
+	{
+		slot = (uint32_t)mSlotGeneration.size();
+		mSlotGeneration.push_back(0);
+		mSlotIndex.push_back(kNoIndex);
+	}
+	// generations start at 1 so that no live handle is ever kInvalid
+	uint32_t gen = (mSlotGeneration[slot] + 1) & (0xFFFFFFFF >> kIndexBits);
+	if(gen == 0)
+		gen = 1;
+	mSlotGeneration[slot] = gen;
+
+	uint32_t index	= Count();
+	uint32_t handle	= slot | (gen << kIndexBits);
+	mSlotIndex[slot] = index;
+	++mRevision;
+
+	mPositionT1.push_back(Vector3D());
+	mVelocityT1.push_back(Vector3D());
+	mOrientationT1.push_back(Quaternion());
+	mAngVelocityT1.push_back(Vector3D());
+	mAngMomentumT1.push_back(Vector3D());
+	mPositionT0.push_back(Vector3D());
+	mVelocityT0.push_back(Vector3D());
+	mOrientationT0.push_back(Quaternion());
+	mAngVelocityT0.push_back(Vector3D());
+	mAngMomentumT0.push_back(Vector3D());
+	mForce.push_back(Vector3D());
+	mTorque.push_back(Vector3D());
+	mMass.push_back(k1);
+	mMassInv.push_back(k1);
+	mInertiaInv.push_back(Vector3D());
+	mLinDamp.push_back(k1);
+	mAngDamp.push_back(k1);
+	mFlags.push_back(0);
+	mQuietTime.push_back(k0);
+	mIsland.push_back(0);
+	mRenderPosition.push_back(Vector3D());
+	mRenderOrientation.push_back(Quaternion());
+	mHandles.push_back(handle);
+	mBodies.push_back(0);
+	mBodies[index] = new RigidBody(this, index, handle);
+
+	return handle;
+}
+
+/*!
+ @param handle
+ @return True if the handle named a live body, which is now destroyed.
+*//*__________________________________________________________________________*/
+bool BodyStore::Destroy(uint32_t handle)
+{
+	RigidBody* body = Lookup(handle);
+	if(!body)
+		return false;
+
+	uint32_t index = body->mIndex;
+	delete body;
+
+	Erase(mPositionT1, index);
+	Erase(mVelocityT1, index);
+	Erase(mOrientationT1, index);
+	Erase(mAngVelocityT1, index);
+	Erase(mAngMomentumT1, index);
+	Erase(mPositionT0, index);
+	Erase(mVelocityT0, index);
+	Erase(mOrientationT0, index);
+	Erase(mAngVelocityT0, index);
+	Erase(mAngMomentumT0, index);
+	Erase(mForce, index);
+	Erase(mTorque, index);
+	Erase(mMass, index);
+	Erase(mMassInv, index);
+	Erase(mInertiaInv, index);
+	Erase(mLinDamp, index);
+	Erase(mAngDamp, index);
+	Erase(mFlags, index);
+	Erase(mQuietTime, index);
+	Erase(mIsland, index);
+	Erase(mRenderPosition, index);
+	Erase(mRenderOrientation, index);
+	Erase(mHandles, index);
+	Erase(mBodies, index);
+
+	uint32_t slot = handle & kIndexMask;
+	mSlotIndex[slot] = kNoIndex;
+	mFreeSlots.push_back(slot);
+	++mRevision;
+
+	// later bodies moved down one place
+	for(uint32_t i = index; i < Count(); ++i)
+	{
+		mBodies[i]->mIndex = i;
+		mSlotIndex[mHandles[i] & kIndexMask] = i;
+	}
+	return true;
+}
+
+/*!
+ @param void
+*//*__________________________________________________________________________*/
+void BodyStore::Clear(void)
+{
+	for(uint32_t i = 0; i < Count(); ++i)
+	{
+		delete mBodies[i];
+		uint32_t slot = mHandles[i] & kIndexMask;
+		mSlotIndex[slot] = kNoIndex;
+		mFreeSlots.push_back(slot);
+	}
+	mPositionT1.clear();
+	mVelocityT1.clear();
+	mOrientationT1.clear();
+	mAngVelocityT1.clear();
+	mAngMomentumT1.clear();
+	mPositionT0.clear();
+	mVelocityT0.clear();
+	mOrientationT0.clear();
+	mAngVelocityT0.clear();
+	mAngMomentumT0.clear();
+	mForce.clear();
+	mTorque.clear();
+	mMass.clear();
+	mMassInv.clear();
+	mInertiaInv.clear();
+	mLinDamp.clear();
+	mAngDamp.clear();
+	mFlags.clear();
+	mQuietTime.clear();
+	mIsland.clear();
+	mRenderPosition.clear();
+	mRenderOrientation.clear();
+	mHandles.clear();
+	mBodies.clear();
+	++mRevision;
+}
+
+/*!
+ @param src	The store to copy.
+
+ Makes this store hold the same bodies as src, under the same handles,
+ with their own copies of the collision shapes. If the bodies are still
+ the ones copied from src last time, only the state arrays are copied,
+ which does not allocate; this makes resetting a scratch engine to a
+ saved table cheap.
+*//*__________________________________________________________________________*/
+void BodyStore::CopyFrom(const BodyStore &src)
+{
+	if(&src == this)
+		return;
+
+	if(mCopySource == &src && mCopySourceRevision == src.mRevision && mCopyRevision == mRevision)
+	{
+		CopyState(src);
+		for(uint32_t i = 0; i < Count(); ++i)
+		{
+			mBodies[i]->mExtent		 = src.mBodies[i]->mExtent;
+			mBodies[i]->mInertiaKind = src.mBodies[i]->mInertiaKind;
+		}
+		return;
+	}
+
+	Clear();
+	mSlotGeneration	= src.mSlotGeneration;
+	mSlotIndex		= src.mSlotIndex;
+	mFreeSlots		= src.mFreeSlots;
+	mHandles		= src.mHandles;
+	// the facades write defaults into the arrays, so size them first and copy after
+	CopyState(src);
+	for(uint32_t i = 0; i < src.Count(); ++i)
+	{
+		const RigidBody* from = src.mBodies[i];
+		RigidBody* body = new RigidBody(this, i, mHandles[i]);
+		body->mExtent		= from->mExtent;
+		body->mCollideGeom	= from->mCollideGeom ? from->mCollideGeom->Clone() : 0;
+		body->mInertiaKind	= from->mInertiaKind;
+		mBodies.push_back(body);
+	}
+	CopyState(src);
+
+	++mRevision;
+	mCopySource			= &src;
+	mCopySourceRevision	= src.mRevision;
+	mCopyRevision		= mRevision;
+}
+
+/*!
+ @param void
+ @return The number of bytes SaveState() writes.
+*//*__________________________________________________________________________*/
+std::size_t BodyStore::StateBytes(void) const
+{
+	std::size_t perBody = 11 * sizeof(Vector3D) + 2 * sizeof(Quaternion) + 5 * sizeof(Real) + sizeof(uint8_t) + 2 * sizeof(uint32_t);
+	return sizeof(uint32_t) + Count() * perBody;
+}
+
+/*!
+ @param out	At least StateBytes() of space.
+ @return One past the last byte written.
+
+ Writes the body count, the handles and then every state array in turn,
+ each as one memcpy.
+*//*__________________________________________________________________________*/
+uint8_t* BodyStore::SaveState(uint8_t* out) const
+{
+	uint32_t count = Count();
+	std::memcpy(out, &count, sizeof(count));
+	out += sizeof(count);
+	Put(out, mHandles);
+	Put(out, mPositionT1);
+	Put(out, mVelocityT1);
+	Put(out, mOrientationT1);
+	Put(out, mAngVelocityT1);
+	Put(out, mAngMomentumT1);
+	Put(out, mPositionT0);
+	Put(out, mVelocityT0);
+	Put(out, mOrientationT0);
+	Put(out, mAngVelocityT0);
+	Put(out, mAngMomentumT0);
+	Put(out, mForce);
+	Put(out, mTorque);
+	Put(out, mMass);
+	Put(out, mMassInv);
+	Put(out, mInertiaInv);
+	Put(out, mLinDamp);
+	Put(out, mAngDamp);
+	Put(out, mFlags);
+	Put(out, mQuietTime);
+	Put(out, mIsland);
+	return out;
+}
+
+/*!
+ @return FNV-1a hash of the handles and the end-of-step state: position,
+		 velocity, orientation, spin and flags. Two stores that have taken the
+		 same steps from the same start hash alike, bit for bit; one flipped
+		 bit anywhere changes it.
+*//*__________________________________________________________________________*/
+uint32_t BodyStore::StateHash(void) const
+{
+	uint32_t hash = 2166136261u;
+	Hash(hash, mHandles);
+	Hash(hash, mPositionT1);
+	Hash(hash, mVelocityT1);
+	Hash(hash, mOrientationT1);
+	Hash(hash, mAngVelocityT1);
+	Hash(hash, mAngMomentumT1);
+	Hash(hash, mFlags);
+	return hash;
+}
+
+/*!
+ @param in	Bytes written by SaveState().
+ @return One past the last byte read, or 0 if the saved bodies are not
+		 the ones in this store, in which case nothing is changed.
+*//*__________________________________________________________________________*/
+const uint8_t* BodyStore::LoadState(const uint8_t* in)
+{
+	uint32_t count;
+	std::memcpy(&count, in, sizeof(count));
+	if(count != Count() || std::memcmp(in + sizeof(count), mHandles.data(), count * sizeof(uint32_t)) != 0)
+		return 0;
+	in += sizeof(count) + count * sizeof(uint32_t);
+
+	Get(in, mPositionT1);
+	Get(in, mVelocityT1);
+	Get(in, mOrientationT1);
+	Get(in, mAngVelocityT1);
+	Get(in, mAngMomentumT1);
+	Get(in, mPositionT0);
+	Get(in, mVelocityT0);
+	Get(in, mOrientationT0);
+	Get(in, mAngVelocityT0);
+	Get(in, mAngMomentumT0);
+	Get(in, mForce);
+	Get(in, mTorque);
+	Get(in, mMass);
+	Get(in, mMassInv);
+	Get(in, mInertiaInv);
+	Get(in, mLinDamp);
+	Get(in, mAngDamp);
+	Get(in, mFlags);
+	Get(in, mQuietTime);
+	Get(in, mIsland);
+	return in;
+}
+
+/*!
+ @param src
+
+ Copies every per-body array; the arrays end up the same size as src's.
+*//*__________________________________________________________________________*/
+void BodyStore::CopyState(const BodyStore &src)
+{
+	mPositionT1		= src.mPositionT1;
+	mVelocityT1		= src.mVelocityT1;
+	mOrientationT1	= src.mOrientationT1;
+	mAngVelocityT1	= src.mAngVelocityT1;
+	mAngMomentumT1	= src.mAngMomentumT1;
+	mPositionT0		= src.mPositionT0;
+	mVelocityT0		= src.mVelocityT0;
+	mOrientationT0	= src.mOrientationT0;
+	mAngVelocityT0	= src.mAngVelocityT0;
+	mAngMomentumT0	= src.mAngMomentumT0;
+	mForce			= src.mForce;
+	mTorque			= src.mTorque;
+	mMass			= src.mMass;
+	mMassInv		= src.mMassInv;
+	mInertiaInv		= src.mInertiaInv;
+	mLinDamp		= src.mLinDamp;
+	mAngDamp		= src.mAngDamp;
+	mFlags			= src.mFlags;
+	mQuietTime		= src.mQuietTime;
+	mIsland			= src.mIsland;
+	mRenderPosition		= src.mRenderPosition;
+	mRenderOrientation	= src.mRenderOrientation;
+}
+
+/*!
+ @param begin	First body.
+ @param end		One past the last body.
+
+ Copies the end state of the last step into the start state of the next,
+ applies contact friction and damping, and sets the spin-down torque.
+*//*__________________________________________________________________________*/
+void BodyStore::ResetForNextTimeStep(uint32_t begin, uint32_t end)
+{
+	for(uint32_t i = begin; i < end; ++i)
+	{
+		uint8_t flags = mFlags[i];
+		if((flags & (kF_Active | kF_Sleeping)) != kF_Active)
+			continue;
+
+		mOrientationT0[i]	= mOrientationT1[i];
+		mPositionT0[i]		= mPositionT1[i];
+		mVelocityT0[i]		= mVelocityT1[i];
+		mAngVelocityT0[i]	= mAngVelocityT1[i];
+		mAngMomentumT0[i]	= mAngMomentumT1[i];
+
+		if(flags & kF_Translatable)
+		{
+			Vec3f velocity = Vec3f::Load(mVelocityT0[i]);
+			Vec3f force = Vec3f::Load(mForce[i]);
+			if(flags & kF_Collided)
+			{
+				force += (Real(-0.95) * velocity.Length()) * velocity;
+				force.Store(mForce[i]);
+			}
+			else
+			{
+				Real forceSquared = Dot(force, force);
+				if(forceSquared < kEpsilon)
+				{
+					(velocity * mLinDamp[i]).Store(mVelocityT0[i]);
+				}
+			}
+		}
+
+		if(flags & kF_Spinnable)
+		{
+			Real aDamp = -mMass[i];
+			(aDamp * Vec3f::Load(mAngVelocityT0[i]).Normal()).Store(mTorque[i]);
+		}
+
+		mFlags[i] = flags & ~kF_Collided;
+	}
+}
+
+/*!
+ @param dt
+ @param begin	First body.
+ @param end		One past the last body.
+
+ note: Call before spring forces are calculated.
+*//*__________________________________________________________________________*/
+void BodyStore::Integrate1(Real dt, uint32_t begin, uint32_t end)
+{
+	for(uint32_t i = begin; i < end; ++i)
+	{
+		uint8_t flags = mFlags[i];
+		if((flags & (kF_Active | kF_Sleeping)) != kF_Active)
+			continue;
+
+		if(flags & kF_Translatable)
+		{
+			Real massInv = mMassInv[i];
+			Vec3f A = Vec3f::Load(mForce[i]) * massInv;
+			Vec3f F;
+			Vec3f k1, k2, k3, k4;
+
+			k1 = A * dt;
+
+			F = F + k1 * .5f;
+			A = F * massInv;
+			k2 = A * dt;
+
+			F = F + k2 * .5f;
+			A = F * massInv;
+			k3 = A * dt;
+
+			F = F + k3;
+			A = F * massInv;
+			k4 = A * dt;
+
+			Vec3f velocity = Vec3f::Load(mVelocityT1[i]) + (k1 + k2 + k3 + k4) * (1.f/6.f);
+			velocity.Store(mVelocityT1[i]);
+			(Vec3f::Load(mPositionT1[i]) + dt * velocity).Store(mPositionT1[i]);
+		}
+		if(flags & kF_Spinnable)
+		{
+			Real inertiaInv = mInertiaInv[i][0];
+			Vec3f A = Vec3f::Load(mTorque[i]) * inertiaInv;
+			Vec3f F;
+			Vec3f k1, k2, k3, k4;
+
+			k1 = A * dt;
+
+			F = F + k1 * .5f;
+			A = F * inertiaInv;
+			k2 = A * dt;
+
+			F = F + k2 * .5f;
+			A = F * inertiaInv;
+			k3 = A * dt;
+
+			F = F + k3;
+			A = F * inertiaInv;
+			k4 = A * dt;
+
+			Vec3f angVelocity = Vec3f::Load(mAngVelocityT1[i]) + (k1 + k2 + k3 + k4) * (1.f/6.f);
+			angVelocity.Store(mAngVelocityT1[i]);
+			Geometry::Vector3D axis;
+			angVelocity.Normal().Store(axis);
+			Quaternion q = mOrientationT1[i];
+			q.Normalize();
+			mOrientationT1[i] += q * axis * static_cast< float >(kHalf * dt);
+			mOrientationT1[i].Normalize();
+		}
+	}
+}
+
+/*!
+ @param dt
+ @param params	Gravity and the velocity and momentum caps.
+ @param begin	First body.
+ @param end		One past the last body.
+
+ note: Call after spring forces are calculated.
+*//*__________________________________________________________________________*/
+void BodyStore::Integrate2(Real dt, const Params &params, uint32_t begin, uint32_t end)
+{
+	const Vec3f g = Vec3f::Load(params.mGravity);
+	for(uint32_t i = begin; i < end; ++i)
+	{
+		uint8_t flags = mFlags[i];
+		if((flags & (kF_Active | kF_Sleeping)) != kF_Active)
+			continue;
+
+		if(flags & kF_Translatable)
+		{
+			Vec3f accel = mMassInv[i] * Vec3f::Load(mForce[i]);
+			if(flags & kF_Gravity)
+				accel += g;
+
+			(Vec3f::Load(mVelocityT1[i]) + (dt * kHalf) * accel).Store(mVelocityT1[i]);
+			mForce[i] = Vector3D();
+		}
+
+		if(flags & kF_Spinnable)
+		{
+			(Vec3f::Load(mAngMomentumT1[i]) + (dt * kHalf) * Vec3f::Load(mTorque[i]).Normal()).Store(mAngMomentumT1[i]);
+			mTorque[i] = Vector3D();
+		}
+		// cap the angular and the linear velocity
+		CapVectorNorm(mVelocityT1[i], params.mMaxLinVel);
+		CapVectorNorm(mAngVelocityT1[i], params.mMaxAngVel);
+		CapVectorNorm(mAngMomentumT1[i], params.mMaxAngMom);
+	}
+}
+
+/*!
+ @param index	Dense index of the body.
+ @param island	Tag shared by every body put to sleep with this one.
+
+ Stops the body dead and takes it out of integration. Wake() undoes it.
+*//*__________________________________________________________________________*/
+void BodyStore::Sleep(uint32_t index, uint32_t island)
+{
+	mVelocityT0[index]		= Vector3D();
+	mVelocityT1[index]		= Vector3D();
+	mAngVelocityT0[index]	= Vector3D();
+	mAngVelocityT1[index]	= Vector3D();
+	mAngMomentumT0[index]	= Vector3D();
+	mAngMomentumT1[index]	= Vector3D();
+	mForce[index]			= Vector3D();
+	mTorque[index]			= Vector3D();
+	mPositionT0[index]		= mPositionT1[index];
+	mOrientationT0[index]	= mOrientationT1[index];
+	mFlags[index]			|= kF_Sleeping;
+	mIsland[index]			= island;
+}
+
+/*!
+ @param index	Dense index of the body.
+ @return The number of bodies woken: the body and the rest of the island
+		 it fell asleep with, or 0 if it was awake.
+*//*__________________________________________________________________________*/
+uint32_t BodyStore::Wake(uint32_t index)
+{
+	if(!(mFlags[index] & kF_Sleeping))
+		return 0;
+
+	uint32_t island = mIsland[index];
+	uint32_t woken = 0;
+	for(uint32_t i = 0; i < Count(); ++i)
+	{
+		if((mFlags[i] & kF_Sleeping) && mIsland[i] == island)
+		{
+			mFlags[i] &= ~kF_Sleeping;
+			mQuietTime[i] = k0;
+			// springs keep pushing on sleepers; none of it was integrated
+			mForce[i] = Vector3D();
+			mTorque[i] = Vector3D();
+			++woken;
+		}
+	}
+	return woken;
+}
+
+/*!
+ @param void
+
+ Remembers where every body is before a fixed step, for RenderPosition()
+ and RenderOrientation() to blend from.
+*//*__________________________________________________________________________*/
+void BodyStore::SaveRenderState(void)
+{
+	mRenderPosition		= mPositionT1;
+	mRenderOrientation	= mOrientationT1;
+}
+
+/*!
+ @param index	Dense index of the body.
+ @param alpha	How far from the saved state towards the current one, 0 to 1.
+ @return The body's position to draw.
+*//*__________________________________________________________________________*/
+Vector3D BodyStore::RenderPosition(uint32_t index, Real alpha) const
+{
+	return mRenderPosition[index] + alpha * (mPositionT1[index] - mRenderPosition[index]);
+}
+
+/*!
+ @param index	Dense index of the body.
+ @param alpha	How far from the saved state towards the current one, 0 to 1.
+ @return The body's orientation to draw; a normalized lerp, which is close
+		 enough to a slerp over one step.
+*//*__________________________________________________________________________*/
+Quaternion BodyStore::RenderOrientation(uint32_t index, Real alpha) const
+{
+	Quaternion from = mRenderOrientation[index];
+	Quaternion to = mOrientationT1[index];
+	// take the short way round
+	if(from.Dot(to) < k0)
+		to = -to;
+	from *= k1 - alpha;
+	to *= alpha;
+	from += to;
+	from.Normalize();
+	return from;
+}
+
+}
@@ -0,0 +1,233 @@
+/*!
+	@file	BodyStore.h
+	@date	October 17, 2026
+
+	@brief	Contiguous storage for rigid body state.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__BODYSTORE_H__
+#define	__BODYSTORE_H__
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "MathDefs.h"
+#include "Geometry.hpp"
+#include "PhysicsDefs.h"
+#include "Quaternion.h"
+
+using Geometry::Vector3D;
+
+namespace Physics
+{
+	class RigidBody;
+
+	/*!
+	 @class		AlignedAllocator
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		std::vector allocator returning cache line aligned blocks.
+	*//*__________________________________________________________________________*/
+	template< typename T_, std::size_t Align_ = 64 >
+	class AlignedAllocator
+	{
+	public:
+		typedef T_				value_type;
+		typedef T_*				pointer;
+		typedef const T_*		const_pointer;
+		typedef T_&				reference;
+		typedef const T_&		const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template< typename U_ > struct rebind { typedef AlignedAllocator< U_, Align_ > other; };
+
+		AlignedAllocator() {}
+		template< typename U_ > AlignedAllocator(const AlignedAllocator< U_, Align_ > &) {}
+
+		/*!
+		 @param n The number of elements to allocate.
+		 @return Storage for n elements, aligned to Align_ bytes.
+		*//*__________________________________________________________________________*/
+		T_* allocate(size_type n)
+		{
+			// over-allocate and remember the offset just before the aligned block
+			char* raw = static_cast< char* >(::operator new(n * sizeof(T_) + Align_ + sizeof(void*)));
+			std::size_t addr = reinterpret_cast< std::size_t >(raw + sizeof(void*));
+			char* aligned = reinterpret_cast< char* >((addr + Align_ - 1) & ~(Align_ - 1));
+			reinterpret_cast< void** >(aligned)[-1] = raw;
+			return reinterpret_cast< T_* >(aligned);
+		}
+		void deallocate(T_* p, size_type)
+		{
+			if(p)
+				::operator delete(reinterpret_cast< void** >(p)[-1]);
+		}
+		template< typename U_ > void construct(U_* p, const U_& val)	{ new(p) U_(val); }
+		template< typename U_ > void destroy(U_* p)						{ p->~U_(); }
+		size_type max_size(void) const { return size_type(-1) / sizeof(T_); }
+
+		bool operator==(const AlignedAllocator &) const { return true; }
+		bool operator!=(const AlignedAllocator &) const { return false; }
+	};
+
+	/*!
+	 @class		BodyStore
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Structure-of-arrays storage for every rigid body in an engine.
+
+		Each attribute lives in its own aligned array indexed by the body's
+		dense index, so the integrator streams through memory instead of
+		chasing one heap block per body. Bodies are named by handles that
+		pack a slot number with a generation count; a handle that outlives
+		its body simply fails to resolve.
+
+		Dense order is creation order. Removal shifts the later bodies down
+		rather than swapping in the last one, so the simulation visits bodies
+		in the same order the old id-keyed map did.
+	*//*__________________________________________________________________________*/
+	class BodyStore
+	{
+	public:
+		template< typename T_ > struct Array { typedef std::vector< T_, AlignedAllocator< T_ > > Type; };
+
+		/// Body flags, one byte per body in mFlags.
+		enum eBodyFlag
+		{
+			kF_Active		= 1 << 0,
+			kF_Spinnable	= 1 << 1,
+			kF_Translatable	= 1 << 2,
+			kF_Collidable	= 1 << 3,
+			kF_Gravity		= 1 << 4,
+			kF_Collided		= 1 << 5,
+			kF_Sleeping		= 1 << 6	///< Skipped by integration until woken.
+		};
+
+		static const uint32_t kIndexBits	= 20;
+		static const uint32_t kIndexMask	= (1u << kIndexBits) - 1;
+		static const uint32_t kInvalid		= 0;
+
+		BodyStore();
+		~BodyStore();
+
+		uint32_t	Create(void);
+		bool		Destroy(uint32_t handle);
+		void		Clear(void);
+		void		CopyFrom(const BodyStore &src);
+
+		// flat copies of the state arrays, for snapshots
+		std::size_t		StateBytes(void) const;
+		uint8_t*		SaveState(uint8_t* out) const;
+		const uint8_t*	LoadState(const uint8_t* in);
+		uint32_t		StateHash(void) const;
+
+		/*!
+		 @param handle
+		 @return The body named by handle, or 0 if the handle is stale.
+		*//*__________________________________________________________________________*/
+		RigidBody*	Lookup(uint32_t handle) const
+		{
+			uint32_t slot = handle & kIndexMask;
+			if(slot >= mSlotGeneration.size() || mSlotGeneration[slot] != (handle >> kIndexBits) || mSlotIndex[slot] == kNoIndex)
+				return 0;
+			return mBodies[mSlotIndex[slot]];
+		}
+		uint32_t	Count(void) const				{ return (uint32_t)mBodies.size(); }
+		RigidBody*	Body(uint32_t index) const		{ return mBodies[index]; }
+		uint32_t	Handle(uint32_t index) const	{ return mHandles[index]; }
+		/// Changes whenever a body is created or destroyed.
+		uint32_t	Revision(void) const			{ return mRevision; }
+
+		// each works on the bodies in [begin, end); disjoint ranges may run in parallel
+		void		ResetForNextTimeStep(uint32_t begin, uint32_t end);
+		void		Integrate1(Real dt, uint32_t begin, uint32_t end);
+		void		Integrate2(Real dt, const Params &params, uint32_t begin, uint32_t end);
+
+		void		Sleep(uint32_t index, uint32_t island);
+		uint32_t	Wake(uint32_t index);
+		bool		Sleeping(uint32_t index) const	{ return (mFlags[index] & kF_Sleeping) != 0; }
+
+		void		SaveRenderState(void);
+		Vector3D	RenderPosition(uint32_t index, Real alpha) const;
+		Quaternion	RenderOrientation(uint32_t index, Real alpha) const;
+
+	public:
+		// state at the end of the time step
+		Array< Vector3D >::Type		mPositionT1;
+		Array< Vector3D >::Type		mVelocityT1;
+		Array< Quaternion >::Type	mOrientationT1;
+		Array< Vector3D >::Type		mAngVelocityT1;
+		Array< Vector3D >::Type		mAngMomentumT1;
+		// state at the beginning of the time step
+		Array< Vector3D >::Type		mPositionT0;
+		Array< Vector3D >::Type		mVelocityT0;
+		Array< Quaternion >::Type	mOrientationT0;
+		Array< Vector3D >::Type		mAngVelocityT0;
+		Array< Vector3D >::Type		mAngMomentumT0;
+		// accumulated forces and torques
+		Array< Vector3D >::Type		mForce;
+		Array< Vector3D >::Type		mTorque;
+		// mass properties
+		Array< Real >::Type			mMass;
+		Array< Real >::Type			mMassInv;
+		Array< Vector3D >::Type		mInertiaInv;		///< Diagonal of inverse inertia matrix.
+		Array< Real >::Type			mLinDamp;
+		Array< Real >::Type			mAngDamp;
+		Array< uint8_t >::Type		mFlags;
+		// sleeping
+		Array< Real >::Type			mQuietTime;			///< Seconds the body has been slow enough to sleep.
+		Array< uint32_t >::Type		mIsland;			///< Tag of the island the body fell asleep with.
+		// state before the last fixed step, for drawing between steps
+		Array< Vector3D >::Type		mRenderPosition;
+		Array< Quaternion >::Type	mRenderOrientation;
+
+	private:
+		static const uint32_t kNoIndex = 0xFFFFFFFF;
+
+		// disabled
+		BodyStore(const BodyStore &);
+		BodyStore& operator=(const BodyStore &);
+
+		template< typename T_ > static void Erase(T_ &array, uint32_t index)	{ array.erase(array.begin() + index); }
+		void		CopyState(const BodyStore &src);
+
+		template< typename T_ > static void Put(uint8_t* &out, const T_ &array)
+		{
+			std::size_t bytes = array.size() * sizeof(typename T_::value_type);
+			std::memcpy(out, array.data(), bytes);
+			out += bytes;
+		}
+		template< typename T_ > static void Hash(uint32_t &hash, const T_ &array)
+		{
+			const uint8_t* bytes = reinterpret_cast< const uint8_t* >(array.data());
+			std::size_t count = array.size() * sizeof(typename T_::value_type);
+			for(std::size_t i = 0; i < count; ++i)
+				hash = (hash ^ bytes[i]) * 16777619u;
+		}
+		template< typename T_ > static void Get(const uint8_t* &in, T_ &array)
+		{
+			std::size_t bytes = array.size() * sizeof(typename T_::value_type);
+			std::memcpy(array.data(), in, bytes);
+			in += bytes;
+		}
+
+		std::vector< RigidBody* >	mBodies;			///< Dense index to body.
+		std::vector< uint32_t >		mHandles;			///< Dense index to handle.
+		std::vector< uint32_t >		mSlotGeneration;	///< Current generation of each slot.
+		std::vector< uint32_t >		mSlotIndex;			///< Dense index of each slot, or kNoIndex.
+		std::vector< uint32_t >		mFreeSlots;
+		uint32_t					mRevision;
+		const BodyStore*			mCopySource;		///< Store the bodies were last copied from.
+		uint32_t					mCopySourceRevision;	///< Its revision at the time.
+		uint32_t					mCopyRevision;		///< Our revision right after the copy.
+	};
+}
+
+#endif
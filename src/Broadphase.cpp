@@ -0,0 +1,263 @@
+/*!
+	@file	Broadphase.cpp
+	@date	October 17, 2026
+
+	@brief	Candidate pair generation for the collision engine.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+
+#include "Broadphase.h"
+#include "RigidBody.h"
+#include "profiler.h"
+
+using Physics::BodyStore;
+
+namespace
+{
+	/// Extra sweep width so float rounding in the predicted keys never drops a pair.
+	const Real kSweepSlack = 1.f / 64.f;
+
+	struct PairLess
+	{
+		bool operator()(const Collision::Pair &lhs, const Collision::Pair &rhs) const
+		{
+			return lhs.mBody1 < rhs.mBody1 || (lhs.mBody1 == rhs.mBody1 && lhs.mBody2 < rhs.mBody2);
+		}
+	};
+
+	/// True if a gap that goes from d0 to d1 over the step stays at least reject wide.
+	inline bool StaysApart(Real d0, Real d1, Real reject)
+	{
+		if((d0 < 0) != (d1 < 0))
+			return false;
+		return std::min(Math::Abs(d0), Math::Abs(d1)) >= reject;
+	}
+
+	inline void PushPair(std::vector< Collision::Pair > &pairs, uint32_t a, uint32_t b)
+	{
+		Collision::Pair p;
+		p.mBody1 = std::min(a, b);
+		p.mBody2 = std::max(a, b);
+		pairs.push_back(p);
+	}
+
+	/*!
+	 @param bodies
+	 @param plane	Dense index of a bounded plane.
+	 @param sphere	Dense index of a sphere.
+	 @return True if the sphere's swept bounds reach the plane's triangle.
+	*//*__________________________________________________________________________*/
+	bool SweptBoundsOverlap(BodyStore &bodies, uint32_t plane, uint32_t sphere)
+	{
+		const Geometry::Triangle3D &tri = ((Physics::BoundedPlane*)bodies.Body(plane)->mCollideGeom)->mPolygon;
+		const Vector3D &p0 = bodies.mPositionT0[sphere];
+		const Vector3D &p1 = bodies.mPositionT1[sphere];
+		Real r = ((Physics::Sphere*)bodies.Body(sphere)->mCollideGeom)->mRadius + kEpsilon;
+
+		for(int axis = 0; axis < 3; ++axis)
+		{
+			Real triMin = (Real)std::min(std::min(tri[0][axis], tri[1][axis]), tri[2][axis]);
+			Real triMax = (Real)std::max(std::max(tri[0][axis], tri[1][axis]), tri[2][axis]);
+			Real sMin = (Real)std::min(p0[axis], p1[axis]) - r;
+			Real sMax = (Real)std::max(p0[axis], p1[axis]) + r;
+			if(sMax < triMin || sMin > triMax)
+				return false;
+		}
+		return true;
+	}
+}
+
+namespace Collision
+{
+/*!
+ @return
+*//*__________________________________________________________________________*/
+Broadphase::Broadphase() : mSphereReject(3.f), mSwept(false), mRevision(0xFFFFFFFF)
+{
+}
+
+/*!
+ @param bodies
+
+ Re-collects the sphere and static lists after bodies were added or removed.
+*//*__________________________________________________________________________*/
+void Broadphase::Rebuild(BodyStore &bodies)
+{
+	mSpheres.clear();
+	mStatics.clear();
+	std::vector< uint32_t > fixed;
+	for(uint32_t i = 0; i < bodies.Count(); ++i)
+	{
+		Physics::GeometryType* geom = bodies.Body(i)->mCollideGeom;
+		if(geom && geom->Kind() == Physics::kC_Sphere)
+			mSpheres.push_back(i);
+		else if(geom && StaticTree::Bounded(bodies, i) && !bodies.Body(i)->Translatable() && bodies.mVelocityT0[i].length() < kEpsilon)
+			fixed.push_back(i);
+		else if(geom)
+			mStatics.push_back(i);
+	}
+	mTree.Build(bodies, fixed);
+	mRevision = bodies.Revision();
+}
+
+/*!
+ @param bodies	The bodies, already integrated to the end of the step.
+ @param dt		The step length.
+*//*__________________________________________________________________________*/
+void Broadphase::Update(BodyStore &bodies, Real dt)
+{
+	ProfileFn;
+	if(mRevision != bodies.Revision())
+		Rebuild(bodies);
+
+	mPairs.clear();
+	mKeys.resize(bodies.Count());
+
+	const uint8_t kCollidable = BodyStore::kF_Collidable;
+	std::vector< uint8_t, Physics::AlignedAllocator< uint8_t > > &flags = bodies.mFlags;
+
+	// predicted Z at the end of the step; the order barely changes between steps
+	Real reach = 0;
+	for(size_t s = 0; s < mSpheres.size(); ++s)
+	{
+		uint32_t i = mSpheres[s];
+		if(mSwept)
+		{
+			mKeys[i] = (Real)bodies.mPositionT1[i][2];
+			reach = std::max(reach, Math::Abs((Real)(bodies.mPositionT1[i][2] - bodies.mPositionT0[i][2])));
+		}
+		else
+			mKeys[i] = (Real)(bodies.mPositionT0[i][2] + bodies.mVelocityT0[i][2] * dt);
+	}
+	for(size_t s = 1; s < mSpheres.size(); ++s)
+	{
+		uint32_t i = mSpheres[s];
+		Real key = mKeys[i];
+		size_t t = s;
+		for(; t > 0 && mKeys[mSpheres[t - 1]] > key; --t)
+			mSpheres[t] = mSpheres[t - 1];
+		mSpheres[t] = i;
+	}
+
+	// sweep the spheres; each pair gets the reject test the all-pairs loop used
+	Real window = mSphereReject + kSweepSlack;
+	// two spheres that end far apart may have passed each other on the way
+	if(mSwept)
+		window += 2 * reach;
+	for(size_t s = 0; s < mSpheres.size(); ++s)
+	{
+		uint32_t a = mSpheres[s];
+		if(!(flags[a] & kCollidable))
+			continue;
+		for(size_t t = s + 1; t < mSpheres.size(); ++t)
+		{
+			uint32_t b = mSpheres[t];
+			if(mKeys[b] - mKeys[a] >= window)
+				break;
+			if(!(flags[b] & kCollidable))
+				continue;
+
+			uint32_t i = std::min(a, b), j = std::max(a, b);
+			Vector3D &v1 = bodies.mVelocityT0[i];
+			Vector3D &v2 = bodies.mVelocityT0[j];
+			// if the objects are not moving, don't test the collision
+			if(v1.length() < kEpsilon && v2.length() < kEpsilon)
+				continue;
+
+			// the paths the integrator produced; VelocityT0 is no guide, since the
+			// reject below flips v1 in place (Vector3D's unary minus negates its operand)
+			if(mSwept)
+			{
+				Vector3D start = bodies.mPositionT0[i] - bodies.mPositionT0[j];
+				Vector3D end = bodies.mPositionT1[i] - bodies.mPositionT1[j];
+				if(StaysApart((Real)start[2], (Real)end[2], mSphereReject)
+					|| StaysApart((Real)start[0], (Real)end[0], mSphereReject)
+					|| StaysApart((Real)start[1], (Real)end[1], mSphereReject))
+					continue;
+				PushPair(mPairs, i, j);
+				continue;
+			}
+
+			// body 2 in body 1's reference frame at the end of the step
+			Vector3D pos1 = bodies.mPositionT0[i];
+			Vector3D vel = v2 + (-v1);
+			Vector3D pos2 = bodies.mPositionT0[j] + vel * dt;
+			if(Math::Abs((Real)(pos1[2] - pos2[2])) >= mSphereReject)
+				continue;
+			if(Math::Abs((Real)(pos1[0] - pos2[0])) >= mSphereReject)
+				continue;
+			if(Math::Abs((Real)(pos1[1] - pos2[1])) >= mSphereReject)
+				continue;
+			PushPair(mPairs, i, j);
+		}
+	}
+
+	// planes and moving shapes against moving spheres
+	const std::vector< uint32_t > &fixed = mTree.Members();
+	for(size_t p = 0; p < mStatics.size(); ++p)
+	{
+		uint32_t a = mStatics[p];
+		if(!(flags[a] & kCollidable))
+			continue;
+		bool bounded = bodies.Body(a)->mCollideGeom->Kind() == Physics::kC_BoundedPlane;
+		bool aMoving = bodies.mVelocityT0[a].length() >= kEpsilon;
+		for(size_t s = 0; s < mSpheres.size(); ++s)
+		{
+			uint32_t b = mSpheres[s];
+			if(!(flags[b] & kCollidable))
+				continue;
+			if(!aMoving && bodies.mVelocityT0[b].length() < kEpsilon)
+				continue;
+			if(bounded && !SweptBoundsOverlap(bodies, a, b))
+				continue;
+			PushPair(mPairs, a, b);
+		}
+		for(size_t q = p + 1; q < mStatics.size(); ++q)
+		{
+			uint32_t b = mStatics[q];
+			if(!(flags[b] & kCollidable))
+				continue;
+			if(!aMoving && bodies.mVelocityT0[b].length() < kEpsilon)
+				continue;
+			PushPair(mPairs, a, b);
+		}
+		// the fixed shapes never move, so only a moving body can reach them
+		for(size_t q = 0; aMoving && q < fixed.size(); ++q)
+		{
+			if(flags[fixed[q]] & kCollidable)
+				PushPair(mPairs, a, fixed[q]);
+		}
+	}
+
+	// fixed bounded shapes: each moving sphere asks the tree
+	for(size_t s = 0; !mTree.Empty() && s < mSpheres.size(); ++s)
+	{
+		uint32_t b = mSpheres[s];
+		if(!(flags[b] & kCollidable) || bodies.mVelocityT0[b].length() < kEpsilon)
+			continue;
+		const Vector3D &p0 = bodies.mPositionT0[b];
+		const Vector3D &p1 = bodies.mPositionT1[b];
+		Real r = ((Physics::Sphere*)bodies.Body(b)->mCollideGeom)->mRadius + kEpsilon;
+		Vector3D lo, hi;
+		for(int axis = 0; axis < 3; ++axis)
+		{
+			lo[axis] = (Real)std::min(p0[axis], p1[axis]) - r;
+			hi[axis] = (Real)std::max(p0[axis], p1[axis]) + r;
+		}
+		mHits.clear();
+		mTree.Query(lo, hi, mHits);
+		for(size_t h = 0; h < mHits.size(); ++h)
+		{
+			if(flags[mHits[h]] & kCollidable)
+				PushPair(mPairs, mHits[h], b);
+		}
+	}
+
+	// narrowphase runs in body order, as it always has
+	std::sort(mPairs.begin(), mPairs.end(), PairLess());
+}
+
+}
@@ -0,0 +1,84 @@
+/*!
+	@file	Broadphase.h
+	@date	October 17, 2026
+
+	@brief	Candidate pair generation for the collision engine.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__BROADPHASE_H__
+#define	__BROADPHASE_H__
+
+#include <vector>
+
+#include "PhysicsDefs.h"
+#include "BodyStore.h"
+#include "StaticTree.h"
+
+namespace Collision
+{
+	/*!
+	 @class		Pair
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Two bodies that may touch this step, by dense index; mBody1 < mBody2.
+	*//*__________________________________________________________________________*/
+	struct Pair
+	{
+		uint32_t	mBody1, mBody2;
+	};
+
+	/*!
+	 @class		Broadphase
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Sweep-and-prune along Z over the spheres, plus bounds culling
+				of the static planes.
+
+		Spheres are kept sorted by their predicted Z position, so from step
+		to step the order is nearly sorted and an insertion sort touches only
+		the bodies that swapped places. The sweep then applies the engine's
+		per-axis proximity reject to each overlapping pair exactly as the
+		all-pairs loop did, so the narrowphase sees the same pairs, in the
+		same order, as before.
+
+		Infinite planes are paired with every moving sphere. Bounded shapes
+		that stay put (the pocket triangles, and any fixed capsule, box or
+		hull) are baked into a StaticTree, which each moving sphere asks for
+		the ones its swept bounds reach. Bounded shapes that move are tested
+		against every sphere the old way.
+	*//*__________________________________________________________________________*/
+	class Broadphase
+	{
+	public:
+		Broadphase();
+		~Broadphase() {}
+
+		void	Update(Physics::BodyStore &bodies, Real dt);
+		/// Rebuild the lists and the tree next update; call when a fixed body moves.
+		void	Invalidate(void)		{ mRevision = 0xFFFFFFFF; }
+
+		/// Spheres whose predicted centers are this far apart on any axis are not paired.
+		Real				mSphereReject;
+		/// Apply the reject to the spheres' whole paths over the step, not just
+		/// where they end up; the event solver needs every pair that may touch.
+		bool				mSwept;
+		/// Candidate pairs from the last update, sorted by (mBody1, mBody2).
+		std::vector< Pair >	mPairs;
+
+	private:
+		void	Rebuild(Physics::BodyStore &bodies);
+
+		std::vector< uint32_t >	mSpheres;		///< Sphere dense indices, sorted on predicted Z.
+		std::vector< uint32_t >	mStatics;		///< Every other body not in mTree.
+		StaticTree				mTree;			///< Fixed bounded bodies.
+		std::vector< uint32_t >	mHits;			///< Tree query results for one sphere.
+		std::vector< Real >		mKeys;			///< Predicted Z by dense index.
+		uint32_t				mRevision;		///< Store revision the lists were built from.
+	};
+}
+
+#endif
@@ -1,598 +1,883 @@
-/*!
-	@file	CollisionEngine.cpp
-	@author	Scott Smith
-	@date	May 04, 2004
-
-	@brief	Internal definitions.
-
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- *//*__________________________________________________________________________*/
-
-#include "main.h"
-
-#include "CollisionEngine.h"
-#include "log.h"
-#include "RuleSystem.h"
-#include "RigidBody.h"
-#include "PhysicsAux.h"
-#include "profiler.h"
-#include "game.h"
-
-using Physics::RigidBody;
-using Geometry::Plane3D;
-using Physics::AuxEngine;
-
-namespace Collision
-{
-	static inline bool Equal(Vector3D u, Vector3D v)
-	{
-		return (Math::Abs((Real)u[0] - (Real)v[0]) + Math::Abs((Real)u[1] - (Real)v[1]) + Math::Abs((Real)u[2] - (Real)v[2])) < kEpsilon;
-	}
-	
-	typedef	bool (*CollisionFn)(AuxEngine*, Contact*, RigidBody* body1, RigidBody* body2);
-	typedef void (*ResolutionFn)(Contact*);
-
-    /*!
-     @param contact 
-     @param body1 
-     @param body2 
-     @return 
-    *//*__________________________________________________________________________*/
-    bool CollidePlanePlane(AuxEngine* Aux, Contact* contact, RigidBody* plane1, RigidBody* plane2)
-	{
-        //ProfileFn;
-		Aux;		// shut up compiler - parameter present to satisfy signature for fp.
-		contact;	// shut up compiler - parameter present to satisfy signature for fp.
-		bool collided = false;
-		if(!(plane1->Translatable() & plane1->Spinnable() & plane2->Translatable() & plane2->Spinnable()))
-		{
-			collided = !Equal(plane1->mExtent, plane2->mExtent);
-		}
-		else
-			collided = true;
-		return collided;
-	}
-	/*!
-	 @param contact 
-	 @param plane 
-	 @param sphere 
-	 @return 
-	*//*__________________________________________________________________________*/
-	bool CollidePlaneSphere(AuxEngine* Aux, Contact* contact, RigidBody* plane, RigidBody* sphere)
-	{
-        //ProfileFn;
-		Plane3D p = ((Physics::Plane*)(plane->mCollideGeom))->mPlane;
-		Vector3D	v0 = sphere->mStateT0.mPosition,
-					v1 = sphere->mStateT1.mPosition;	
-		Geometry::Point3D	c0(v0[0], v0[1], v0[2]),
-							c1(v1[0], v1[1], v1[2]);
-		Real d0 = (Real)Geometry::Distance(c0, p);
-		Real d1 = (Real)Geometry::Distance(c1, p);
-		Real radius = ((Physics::Sphere*)sphere->mCollideGeom)->mRadius;
-		bool ret = false;
-		
-		
-
-		if(Math::Abs(d0) <= radius + kEpsilon)
-		{
-			contact->mNormal = p.normal();
-			contact->mTime = k0;
-			ret = true;
-		}
-		else if(d0 > radius && d1 < radius)
-		{
-			// penetration
-			contact->mNormal = p.normal();
-			Real u = (d0 - radius)/(d0 - d1);
-			v1 *= u;
-			v0 *= (k1 - u);
-			contact->mPosition = v0 + v1;
-			ret = true;
-			contact->mTime = u;
-		}
-		
-		// check to see if the plane is bounded, then perform a containment check for the contact point.
-		if(ret && plane->mCollideGeom->Kind() == Physics::kC_BoundedPlane)
-		{
-			Geometry::Point3D pt(contact->mPosition[0], contact->mPosition[1], contact->mPosition[2]);
-			if(!((Physics::BoundedPlane*)(plane->mCollideGeom))->mPolygon.contains(pt))
-			{
-				ret = false;
-			}
-			else
-			{	
-				Physics::RigidBodyMap::iterator it = Aux->mBodies.begin();
-				for(;it != Aux->mBodies.end(); ++it)
-				{
-					if(plane == it->second)
-					{
-						contact->mID1 = it->first;
-						contact->mBody1 = it->second;
-						Physics::RigidBodyMap::iterator it2 = Aux->mBodies.begin();
-						for(;it2 != Aux->mBodies.end(); ++it2)
-						{
-							if(sphere == it2->second)
-							{
-								contact->mID2 = it2->first;
-								contact->mBody2 = it2->second;
-							}
-						}
-					}
-				}
-				if(Aux->mCallbacks.count(kCollisionCBSpherePocket) != 0 && Aux->mCallbacks[kCollisionCBSpherePocket] != 0)
-				{
-					Aux->mCallbacks[kCollisionCBSpherePocket](contact, plane, sphere);
-				}
-				if(ret && Aux->mCallbacks.count(kCallbackRuleSBP) != 0 && Aux->mCallbacks[kCallbackRuleSBP] != 0)
-				{
-					//Aux->mCallbacks[kCallbackRuleLog](contact, plane, sphere);
-					Aux->mCallbacks[kCallbackRuleSBP](contact, plane, sphere);
-				}
-				return true;
-			}
-		}
-
-		// (jmp) Send a message.
-		if(ret && Aux->mCallbacks.count(kCollisionCBSpherePlane) != 0 && Aux->mCallbacks[kCollisionCBSpherePlane] != 0)
-		{
-			Physics::RigidBodyMap::iterator it = Aux->mBodies.begin();
-			for(;it != Aux->mBodies.end(); ++it)
-			{
-				if(plane == it->second)
-				{
-					contact->mID1 = it->first;
-					contact->mBody1 = it->second;
-					Physics::RigidBodyMap::iterator it2 = Aux->mBodies.begin();
-					for(;it2 != Aux->mBodies.end(); ++it2)
-					{
-						if(sphere == it2->second)
-						{
-							contact->mID2 = it2->first;
-							contact->mBody2 = it2->second;
-						}
-					}
-				}
-			}
-			Aux->mCallbacks[kCollisionCBSpherePlane](contact, plane, sphere);
-		}
-		if(ret && Aux->mCallbacks.count(kCallbackRuleSP) != 0 && Aux->mCallbacks[kCallbackRuleSP] != 0)
-		{
-			//Aux->mCallbacks[kCallbackRuleLog](contact, plane, sphere);
-			Aux->mCallbacks[kCallbackRuleSP](contact, plane, sphere);
-		}
-		return ret;
-	}
-	/*!
-	 @param contact 
-	 @param sphere 
-	 @param plane 
-	 @return 
-	*//*__________________________________________________________________________*/
-	bool CollideSpherePlane(AuxEngine* Aux, Contact* contact, RigidBody* sphere, RigidBody* plane)
-	{
-		return CollidePlaneSphere(Aux, contact, plane, sphere);
-	}
-
-	inline bool QuadraticFormula(Real a, Real b, Real c, Real& root1, Real& root2)
-	{
-        //ProfileFn;
-		Real q = b*b - 4.f * a * c;
-		if(q >= k0)
-		{
-			Real sq = /*Math::S*/sqrt(q);
-			Real d = k1 / (2.f * a);
-			root1 = (-b + sq) * d;
-			root2 = (-b - sq) * d;
-			return true;
-		}
-		else
-			return false; // complex roots
-	}
-
-	/*!
-	 @param contact 
-	 @param sphere1 
-	 @param sphere2 
-	 @return 
-	*//*__________________________________________________________________________*/
-	bool CollideSphereSphere(AuxEngine* Aux, Contact* contact, RigidBody* sphere1, RigidBody* sphere2)
-	{
-        ProfileFn;
-		//Initialize the return value
-		bool ret = false;
-        float tmin = kMax;
-
-        //double tmin = 0.0f;
-
-		Real	radius1 = ((Physics::Sphere*)sphere1->mCollideGeom)->mRadius, 
-				radius2 = ((Physics::Sphere*)sphere2->mCollideGeom)->mRadius;
-
-		// Relative velocity
-		Vector3D va = sphere1->mStateT1.mPosition - sphere1->mStateT0.mPosition;
-		Vector3D vb = sphere2->mStateT1.mPosition - sphere2->mStateT0.mPosition;
-		Vector3D    dv = vb - va;//obj2->prVelocity - obj1->prVelocity;
-
-		
-		// Relative position
-		Vector3D	dp = sphere2->mStateT0.mPosition - sphere1->mStateT0.mPosition;//obj2->prPosition - obj1->prPosition;
-       		
-		//Minimal distance squared
-		float r = radius1 + radius2;//obj1->fRadius + obj2->fRadius;
-		//dP^2-r^2
-		float pp = dp[0] * dp[0] + dp[1] * dp[1] + dp[2] * dp[2] - r * r;
-		//(1)Check if the spheres are already intersecting
-		if ( pp < 0 ) 
-		{
-			contact->mNormal = (sphere1->mStateT1.mPosition - sphere2->mStateT1.mPosition).normal();
-			ret = true;
- //           goto exit_ss;
-		}
-
-		//dP*dV
-		float pv    = dp[0] * dv[0] + dp[1] * dv[1] + dp[2] * dv[2];
-		//(2)Check if the spheres are moving away from each other
-		if ( pv >= 0 ) 
-        {
-			ret = false;
-            goto exit_ss; 
-        }
-
-		//dV^2
-		float vv = dv[0] * dv[0] + dv[1] * dv[1] + dv[2] * dv[2];
-		//(3)Check if the spheres can intersect within 1 frame
-		if ( (pv + vv) <= 0 && (vv + 2 * pv + pp) >= 0 ) 
-        {
-			ret = false;
-            goto exit_ss;
-        }
-
-		//tmin = -dP*dV/dV*2 
-		//the time when the distance between the spheres is minimal
-		tmin = -pv/vv;
-
-		//Discriminant/(4*dV^2) = -(dp^2-r^2+dP*dV*tmin)
-		//ret = ( pp + pv * tmin > 0 );
-		
-		//if(ret)
-		//{
-		//	contact->mNormal = (sphere1->mStateT1.mPosition - sphere2->mStateT1.mPosition).normal();
-		//	contact->mPosition = (sphere1->mStateT0.mPosition + tmin * (sphere1->mStateT0.mVelocity.normal())) + radius1 * contact->mNormal;
-			
-	//	}
-		//return ret;
-	//	Aux;  // shut up the compiler
-	//	
-/****************************
-This one ~works
-****************************/
-		//bool ret = false;
-  //      Real	u0, u1;
-		//Real	radius1 = ((Physics::Sphere*)sphere1->mCollideGeom)->mRadius, 
-		//		radius2 = ((Physics::Sphere*)sphere2->mCollideGeom)->mRadius;
-		//Vector3D va = sphere1->mStateT1.mPosition - sphere1->mStateT0.mPosition;
-		//Vector3D vb = sphere2->mStateT1.mPosition - sphere2->mStateT0.mPosition;
-		//Vector3D vab = vb - va;
-		//Vector3D ab = sphere2->mStateT0.mPosition - sphere1->mStateT0.mPosition;
-		//Real	rab = radius1 + radius2;
-		//Real	a = (Real)(vab * vab);
-		//Real	b = 2.f * (Real)(vab * ab);
-		//Real	c = (Real)(ab * ab) - Math::Sqr(rab);
-
-		//if(c <= k0)
-		//{
-		//	u0 = k0;
-		//	u1 = k0;
-		//	ret = true;
-		//}
-		//if(!ret)
-		//{
-		//	// test the relative velocities
-		//	if(Math::Abs(a) < kEpsilon)
-		//		ret = false;			
-		//}
-		//else if(QuadraticFormula(a, b, c, u0, u1))
-		//{
-		//	if(u0 > u1)
-		//		Math::Swap(u0, u1);
-		//	if(u0 < k0 &&  u1 < k0)
-		//		ret = false;
-		//	else if(u1 > k1 && u0 > k1)
-		//		ret = false;
-		//	else
-		//		ret = true;
-		//}
-exit_ss:
-		// employ callback mechanism
-		if(ret)
-		{
-			contact->mNormal = (sphere1->mStateT1.mPosition - sphere2->mStateT1.mPosition).normal();
-            //contact->mNormal = ((sphere2->mStateT0.mPosition + (tmin * sphere2->mStateT0.mVelocity.normal())) - (sphere1->mStateT0.mPosition + (tmin * sphere1->mStateT0.mVelocity.normal()))).normal();
-			contact->mBody1 = sphere1;
-			contact->mBody2 = sphere2;
-            contact->mTime = tmin;
-            contact->mPosition = (sphere1->mStateT0.mPosition + tmin * (sphere1->mStateT0.mVelocity.normal())) + radius1 * contact->mNormal;
-			Physics::RigidBodyMap::iterator it = Aux->mBodies.begin();
-			while(it != Aux->mBodies.end())
-			{
-				if(it->second == sphere1)
-				{
-					contact->mID1 = it->first;
-					contact->mBody1 = sphere1;
-				}
-				else if(it->second == sphere2)
-				{
-					contact->mID2 = it->first;
-					contact->mBody2 = sphere2;
-				}
-				++it;
-			}
-		}
-		if(ret && Aux->mCallbacks.count(kCallbackRuleSS) != 0 && Aux->mCallbacks[kCallbackRuleSS] != 0)
-		{
-			//Aux->mCallbacks[kCallbackRuleLog](contact, plane, sphere);
-			Aux->mCallbacks[kCallbackRuleSS](contact, sphere1, sphere2);
-		}
-		if(ret && Aux->mCallbacks.count(kCollisionCBSphereSphere) != 0 && Aux->mCallbacks[kCollisionCBSphereSphere] != 0)
-		{
-			//Aux->mCallbacks[kCallbackRuleLog](contact, plane, sphere);
-			Aux->mCallbacks[kCollisionCBSphereSphere](contact, sphere1, sphere2);
-		}
-
-		
-		return ret;
-	}
-
-	//CollisionFn CollisionFunctions[2][2] = {	CollidePlanePlane, CollidePlaneSphere, CollideSpherePlane, CollideSphereSphere };
-	CollisionFn CollisionFunctions[3][3] = {	CollidePlanePlane, CollidePlaneSphere, CollidePlanePlane,
-												CollideSpherePlane, CollideSphereSphere, CollideSpherePlane,
-												CollidePlanePlane, CollidePlaneSphere, CollidePlanePlane};
-
-	/*!
-	 @param body1 
-	 @param body2 
-	 @return 
-	*//*__________________________________________________________________________*/
-	Contact* Collision::Engine::TestCollision(RigidBody* body1, RigidBody* body2)
-	{
-        //ProfileFn;
-		Contact* ret = 0;
-
-    ENFORCE(mFreePool.size() != 0)("Contact pool is empty."); // (jmp)
-		/*if(mFreePool.size() == 0)
-		{ 
-			throw(nsl::exception("Contact pool is empty.", __FILE__, __LINE__, __FUNCTION__));
-			exit(0);
-		}*/
-		Contact* contact = mFreePool.front();
-		mFreePool.pop_front();
-
-		if(CollisionFunctions[body1->mCollideGeom->Kind()][body2->mCollideGeom->Kind()](mParentPE, contact, body1, body2))
-		{
-			mContacts.push_back(contact);
-			contact->mBody1 = body1;
-			contact->mBody2 = body2;
-			ret = contact;
-		}
-		else
-		{
-			mFreePool.push_back(contact);
-		}
-
-        return ret;
-	}
-
-	/*!
-	 @param contact 
-	*//*__________________________________________________________________________*/
-	void _ResolveSpherePlane(Contact* contact)
-	{
-        //ProfileFn;
-		//RigidBody* plane = contact->mBody1;
-		RigidBody* sphere = contact->mBody2;
-		Vector3D temp;
-		Vector3D vContact;
-		Physics::Sphere* spherePtr = (Physics::Sphere*)sphere->mCollideGeom;
-		vContact = -spherePtr->mRadius * contact->mNormal;
-		Vector3D vel1 = sphere->mStateT1.mVelocity;
-
-		if(sphere->Spinnable())
-		{
-			vel1 += (sphere->mStateT1.mAngularVelocity ^ vContact);
-		}
-
-		Real velNormalDir = (Real)(vel1 * contact->mNormal);
-		if(velNormalDir < k0)
-		{
-			Real ImpulseNumerator = -(k1 + CoeffRestSP) * velNormalDir;
-			temp = vContact ^ vel1;//contact->mNormal;
-			if(sphere->InertiaKind() == Physics::kI_Sphere)
-			{
-				temp *= sphere->mInertiaTensorInv[0];
-			}
-			else
-			{
-				temp[0] = temp[0] * sphere->mInertiaTensorInv[0];
-				temp[1] = temp[1] * sphere->mInertiaTensorInv[1];
-				temp[2] = temp[2] * sphere->mInertiaTensorInv[2];
-			}
-			Vector3D temp2 = temp ^ vContact;
-
-			Real ImpulseDenominator = (Real)(sphere->MassInv() + (temp2 * contact->mNormal));
-			Real result = (sphere->MassInv() * ImpulseNumerator) / ImpulseDenominator;
-			Vector3D impulse = result * contact->mNormal;
-			sphere->mStateT1.mVelocity += impulse;
-			//sphere->mStateT1.mAngularMomentum += .25 * temp2;//contact->mNormal ^ impulse;
-			sphere->mStateT1.mAngularVelocity += temp2;// ^ impulse;
-		}
-	}
-	/*!
-	 @param contact 
-	*//*__________________________________________________________________________*/
-	void ResolvePlanePlane(Contact* contact)
-	{
-		contact;	// shut up compiler - parameter present to satisfy signature for fp.
-	}
-	/*!
-	 @param contact 
-	*//*__________________________________________________________________________*/
-	void ResolvePlaneSphere(Contact* contact)
-	{
-        //ProfileFn;
-		//RigidBody* plane = contact->mBody1;
-		RigidBody* sphere = contact->mBody2;
-		Vector3D adjust = sphere->mStateT1.mPosition - contact->mPosition;
-		Real residual = (Real)adjust.length();
-		sphere->mStateT1.mPosition = contact->mPosition;
-
-		_ResolveSpherePlane(contact);
-
-		adjust = sphere->mStateT1.mVelocity.normal();
-		sphere->mStateT1.mPosition += residual * adjust;
-	}
-	/*!
-	 @param contact 
-	*//*__________________________________________________________________________*/
-	void ResolveSpherePlane(Contact* contact)
-	{
-        //ProfileFn;
-		RigidBody* temp = contact->mBody1;
-		contact->mBody1 = contact->mBody2;
-		contact->mBody2 = temp;
-		contact->mNormal *= kN1;
-		ResolvePlaneSphere(contact);
-	}
-	/*!
-	 @param contact 
-	*//*__________________________________________________________________________*/
-	void ResolveSphereSphere(Contact* contact)
-	{
-        //ProfileFn;
-		RigidBody* body1 = contact->mBody1;
-		RigidBody* body2 = contact->mBody2;
-		Vector3D temp, temp2;
-		Vector3D contact1, contact2;
-		Vector3D velocityA, velocityB, velocityAB;
-
-		Physics::Sphere* sphere1 = (Physics::Sphere*)body1->mCollideGeom;
-		Physics::Sphere* sphere2 = (Physics::Sphere*)body2->mCollideGeom;
-
-		contact1 = -sphere1->mRadius * contact->mNormal;
-		contact2 = sphere2->mRadius * contact->mNormal;
-		velocityA = body1->mStateT1.mVelocity;
-		velocityB = body2->mStateT1.mVelocity;
-
-		if(body1->Spinnable())
-		{
-			temp = body1->mStateT0.mAngularVelocity ^ contact1;
-			velocityA += temp;
-		}
-		if(body2->Spinnable())
-		{
-			temp = body2->mStateT0.mAngularVelocity ^ contact2;
-			velocityB += temp;
-		}
-		velocityAB = velocityA - velocityB; // relative velocity
-		Real velNormalDir = (Real)(velocityAB * contact->mNormal);
-
-		if(velNormalDir < k0) // objects are moving toward one another
-		{
-			Real impulseNumerator = -(k1 + CoeffRestSS) * velNormalDir;
-			temp = contact1 ^ velocityA;//contact->mNormal;
-			if(body1->InertiaKind() == Physics::kI_Sphere)
-			{
-				temp *= body1->mInertiaTensorInv[0];
-			}
-			else
-			{
-				temp[0] = temp[0] * body1->mInertiaTensorInv[0];
-				temp[1] = temp[1] * body1->mInertiaTensorInv[1];
-				temp[2] = temp[2] * body1->mInertiaTensorInv[2];
-			}
-			temp2 = temp ^ contact1;
-			Real impulseDenominator = (Real)(body1->MassInv() + (temp2 * contact->mNormal) + body2->MassInv());
-
-			if(body2->InertiaKind() == Physics::kI_Sphere)
-			{
-				temp *= body2->mInertiaTensorInv[0];
-			}
-			else
-			{
-				temp[0] = temp[0] * body2->mInertiaTensorInv[0];
-				temp[1] = temp[1] * body2->mInertiaTensorInv[1];
-				temp[2] = temp[2] * body2->mInertiaTensorInv[2];
-			}
-			// apply impulse to body1
-			temp2 = temp ^ contact2;
-			impulseDenominator += Real(temp2 * contact->mNormal);
-			Vector3D impulse;
-			Real result = (body1->MassInv() * impulseNumerator) / impulseDenominator;
-			impulse = result * contact->mNormal;
-			body1->mStateT1.mVelocity += impulse;
-			// apply opposite impulse to body2
-			Vector3D negImpulse = kN1 * body2->MassInv() * impulse;
-			body2->mStateT1.mVelocity += negImpulse;
-
-			temp2 += contact->mNormal ^ impulse;
-			body1->mStateT1.mAngularMomentum += .05f * temp2;
-			temp2 *= kN1;
-			body2->mStateT1.mAngularMomentum += .05f * temp2;
-		}
-	}
-	//ResolutionFn ResolveFunctions[2][2] = { ResolvePlanePlane, ResolvePlaneSphere, ResolveSpherePlane, ResolveSphereSphere };
-	ResolutionFn ResolveFunctions[3][3] = { ResolvePlanePlane, ResolvePlaneSphere, ResolvePlanePlane,
-											ResolveSpherePlane, ResolveSphereSphere, ResolveSpherePlane,
-											ResolvePlanePlane, ResolvePlaneSphere, ResolvePlanePlane};
-	/*!
-	 @param contact 
-	*//*__________________________________________________________________________*/
-	void Collision::Engine::Resolve(Contact* contact)
-	{
-		ResolveFunctions[contact->mBody1->mCollideGeom->Kind()][contact->mBody2->mCollideGeom->Kind()](contact);
-		contact->mBody1->mCollided = true;
-		contact->mBody2->mCollided = true;
-	}
-	/*!
-	 @return 
-	*//*__________________________________________________________________________*/
-	Collision::Engine::Engine(Physics::AuxEngine* parent):mParentPE(parent)
-	{
-		SetCapacity(2048);
-	}
-	/*!
-	 @return 
-	*//*__________________________________________________________________________*/
-	Collision::Engine::~Engine() 
-	{ 
-        // clean up the collision free pool
-		std::list< Collision::Contact* >::iterator it = mFreePool.begin();
-        while(it != mFreePool.end())
-        {
-            delete (*it);
-            ++it;
-        }
-	}
-	/*!
-	*//*__________________________________________________________________________*/
-	void Collision::Engine::Begin() {}
-	/*!
-	*//*__________________________________________________________________________*/
-	void Collision::Engine::End()
-	{
-		while(mContacts.size() > 0)
-		{
-			Contact* contact = mContacts.back();
-			mContacts.pop_back();
-			mFreePool.push_back(contact);
-		}
-	}
-	/*!
-	 @param maxContacts 
-	*//*__________________________________________________________________________*/
-	void Collision::Engine::SetCapacity(int maxContacts)
-	{
-		int num = maxContacts - (int)mFreePool.size();
-		while(--num >= 0)
-			mFreePool.push_back(new Contact());
-	}
-
+/*!
+	@file	CollisionEngine.cpp
+	@author	Scott Smith
+	@date	May 04, 2004
+
+	@brief	Internal definitions.
+
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "CollisionEngine.h"
+#include "SphereKernels.h"
+#include "RigidBody.h"
+#include "PhysicsAux.h"
+#include "enforcer.h"
+#include "profiler.h"
+
+using Physics::RigidBody;
+using Geometry::Plane3D;
+using Physics::AuxEngine;
+
+namespace Collision
+{
+	static inline bool Equal(Vector3D u, Vector3D v)
+	{
+		return (Math::Abs((Real)u[0] - (Real)v[0]) + Math::Abs((Real)u[1] - (Real)v[1]) + Math::Abs((Real)u[2] - (Real)v[2])) < kEpsilon;
+	}
+	
+	struct ContactOrderLess
+	{
+		bool operator()(const Contact* lhs, const Contact* rhs) const
+		{
+			return lhs->mOrder < rhs->mOrder;
+		}
+	};
+
+    /*!
+     @param contact 
+     @param body1 
+     @param body2 
+     @return 
+    *//*__________________________________________________________________________*/
+    bool CollidePlanePlane(AuxEngine* Aux, Contact* contact, RigidBody* plane1, RigidBody* plane2)
+	{
+        //ProfileFn;
+		Aux;		// shut up compiler - parameter present to satisfy signature for fp.
+		contact;	// shut up compiler - parameter present to satisfy signature for fp.
+		bool collided = false;
+		if(!(plane1->Translatable() & plane1->Spinnable() & plane2->Translatable() & plane2->Spinnable()))
+		{
+			collided = !Equal(plane1->mExtent, plane2->mExtent);
+		}
+		else
+			collided = true;
+		return collided;
+	}
+	/*!
+	 @param contact 
+	 @param plane 
+	 @param sphere 
+	 @return 
+	*//*__________________________________________________________________________*/
+	bool CollidePlaneSphere(AuxEngine* Aux, Contact* contact, RigidBody* plane, RigidBody* sphere)
+	{
+        //ProfileFn;
+		(void)Aux;		// shut up compiler - parameter present to satisfy signature for fp.
+		Plane3D p = ((Physics::Plane*)(plane->mCollideGeom))->mPlane;
+		Vector3D	v0 = sphere->PositionT0(),
+					v1 = sphere->PositionT1();	
+		Geometry::Point3D	c0(v0[0], v0[1], v0[2]),
+							c1(v1[0], v1[1], v1[2]);
+		Real d0 = (Real)Geometry::Distance(c0, p);
+		Real d1 = (Real)Geometry::Distance(c1, p);
+		Real radius = ((Physics::Sphere*)sphere->mCollideGeom)->mRadius;
+		bool ret = false;
+		
+		
+
+		if(Math::Abs(d0) <= radius + kEpsilon)
+		{
+			contact->mNormal = p.normal();
+			contact->mPosition = v0;
+			contact->mTime = k0;
+			ret = true;
+		}
+		else if(d0 > radius && d1 < radius)
+		{
+			// penetration
+			contact->mNormal = p.normal();
+			Real u = (d0 - radius)/(d0 - d1);
+			v1 *= u;
+			v0 *= (k1 - u);
+			contact->mPosition = v0 + v1;
+			ret = true;
+			contact->mTime = u;
+		}
+		
+		contact->mDepth = radius - d1;
+
+		// check to see if the plane is bounded, then perform a containment check for the contact point.
+		if(ret && plane->mCollideGeom->Kind() == Physics::kC_BoundedPlane)
+		{
+			Geometry::Point3D pt(contact->mPosition[0], contact->mPosition[1], contact->mPosition[2]);
+			if(!((Physics::BoundedPlane*)(plane->mCollideGeom))->mPolygon.contains(pt))
+			{
+				ret = false;
+			}
+			else
+			{	
+				contact->mID1 = plane->Handle();
+				contact->mID2 = sphere->Handle();
+				contact->mEvent = Contact::kEvent_SpherePocket;
+				return true;
+			}
+		}
+
+		// (jmp) Send a message, once the narrowphase is done (see Engine::Dispatch).
+		if(ret)
+		{
+			contact->mID1 = plane->Handle();
+			contact->mID2 = sphere->Handle();
+			contact->mEvent = Contact::kEvent_SpherePlane;
+		}
+		return ret;
+	}
+	/*!
+	 @param contact 
+	 @param sphere 
+	 @param plane 
+	 @return 
+	*//*__________________________________________________________________________*/
+	bool CollideSpherePlane(AuxEngine* Aux, Contact* contact, RigidBody* sphere, RigidBody* plane)
+	{
+		return CollidePlaneSphere(Aux, contact, plane, sphere);
+	}
+
+	inline bool QuadraticFormula(Real a, Real b, Real c, Real& root1, Real& root2)
+	{
+        //ProfileFn;
+		Real q = b*b - 4.f * a * c;
+		if(q >= k0)
+		{
+			Real sq = /*Math::S*/sqrt(q);
+			Real d = k1 / (2.f * a);
+			root1 = (-b + sq) * d;
+			root2 = (-b - sq) * d;
+			return true;
+		}
+		else
+			return false; // complex roots
+	}
+
+	/*!
+	 @param contact 
+	 @param sphere1 
+	 @param sphere2 
+	 @param time	From SweepSpheres().
+	 @param normal	Unit vector from sphere2 to sphere1 at the end of the step.
+	*//*__________________________________________________________________________*/
+	static void FillSphereSphere(Contact* contact, RigidBody* sphere1, RigidBody* sphere2, Real time, const Vector3D &normal)
+	{
+		Real	radius1 = ((Physics::Sphere*)sphere1->mCollideGeom)->mRadius;
+		Real	radius2 = ((Physics::Sphere*)sphere2->mCollideGeom)->mRadius;
+
+		// employ callback mechanism
+		contact->mNormal = normal;
+		contact->mBody1 = sphere1;
+		contact->mBody2 = sphere2;
+		contact->mTime = time;
+		contact->mPosition = (sphere1->PositionT0() + time * (sphere1->VelocityT0().normal())) + radius1 * contact->mNormal;
+		contact->mDepth = radius1 + radius2 - (Real)(sphere1->PositionT1() - sphere2->PositionT1()).length();
+		contact->mID1 = sphere1->Handle();
+		contact->mID2 = sphere2->Handle();
+		contact->mEvent = Contact::kEvent_SphereSphere;
+	}
+
+	/*!
+	 @param contact 
+	 @param sphere1 
+	 @param sphere2 
+	 @return 
+	*//*__________________________________________________________________________*/
+	bool CollideSphereSphere(AuxEngine* Aux, Contact* contact, RigidBody* sphere1, RigidBody* sphere2)
+	{
+        //ProfileFn;	// runs on the worker threads; the profiler is not thread-safe
+		(void)Aux;		// shut up compiler - parameter present to satisfy signature for fp.
+
+		SphereSweep	sweep1 = { sphere1->PositionT0(), sphere1->PositionT1(), ((Physics::Sphere*)sphere1->mCollideGeom)->mRadius },
+					sweep2 = { sphere2->PositionT0(), sphere2->PositionT1(), ((Physics::Sphere*)sphere2->mCollideGeom)->mRadius };
+		Real	tmin;
+
+		if(!SweepSpheres(sweep1, sweep2, tmin))
+			return false;
+
+		FillSphereSphere(contact, sphere1, sphere2, tmin, (sphere1->PositionT1() - sphere2->PositionT1()).normal());
+		return true;
+	}
+
+	/*!
+	 @param contact 
+	 @param sphere1 
+	 @param sphere2 
+	 @return true if the spheres first touch within the step; the contact
+			 normal is taken at that moment.
+	*//*__________________________________________________________________________*/
+	static bool ImpactSphereSphere(Contact* contact, RigidBody* sphere1, RigidBody* sphere2)
+	{
+		SphereSweep	sweep1 = { sphere1->PositionT0(), sphere1->PositionT1(), ((Physics::Sphere*)sphere1->mCollideGeom)->mRadius },
+					sweep2 = { sphere2->PositionT0(), sphere2->PositionT1(), ((Physics::Sphere*)sphere2->mCollideGeom)->mRadius };
+		Real	time;
+
+		if(!SphereTimeOfImpact(sweep1, sweep2, time))
+			return false;
+
+		Vector3D at1 = sphere1->PositionT0() + time * (sphere1->PositionT1() - sphere1->PositionT0());
+		Vector3D at2 = sphere2->PositionT0() + time * (sphere2->PositionT1() - sphere2->PositionT0());
+		FillSphereSphere(contact, sphere1, sphere2, time, (at1 - at2).normal());
+		return true;
+	}
+
+	/*!
+	 @param contact 
+	 @param shape	A capsule, box or hull.
+	 @param sphere 
+	 @param surface	The point of the shape nearest the sphere's centre at the end of the step.
+	 @param normal	Unit vector from surface towards the sphere's centre.
+	 @return 
+
+	 Fills a contact the way CollidePlaneSphere() does, treating the shape
+	 as the plane through surface with the given normal: touching at the
+	 start of the step, or reached part way through it.
+	*//*__________________________________________________________________________*/
+	static bool FillShapeSphere(Contact* contact, RigidBody* shape, RigidBody* sphere, Vector3D surface, Vector3D normal)
+	{
+		Vector3D	v0 = sphere->PositionT0(),
+					v1 = sphere->PositionT1();
+		Real radius = ((Physics::Sphere*)sphere->mCollideGeom)->mRadius;
+		Real d0 = (Real)((v0 - surface) * normal);
+		Real d1 = (Real)((v1 - surface) * normal);
+
+		if(d0 <= radius + kEpsilon)
+		{
+			contact->mPosition = v0;
+			contact->mTime = k0;
+		}
+		else if(d1 < radius)
+		{
+			Real u = (d0 - radius)/(d0 - d1);
+			contact->mPosition = (k1 - u) * v0 + u * v1;
+			contact->mTime = u;
+		}
+		else
+			return false;
+
+		contact->mNormal = normal;
+		contact->mDepth = radius - d1;
+		contact->mID1 = shape->Handle();
+		contact->mID2 = sphere->Handle();
+		contact->mEvent = Contact::kEvent_SpherePlane;
+		return true;
+	}
+	/*!
+	 @param offset		The sphere's centre less the shape's centre.
+	 @param surface		Receives the nearest point of the shape, relative to its centre.
+	 @param normal		Receives the direction from surface to the centre.
+	 @return The distance from the shape to the centre, negative inside.
+
+	 Shared tail of the shape tests: a centre on the surface itself has no
+	 direction of its own, so it takes fallback.
+	*//*__________________________________________________________________________*/
+	static Real Separation(Vector3D offset, Vector3D surface, Vector3D fallback, Vector3D &normal)
+	{
+		Vector3D gap = offset - surface;
+		Real length = (Real)gap.length();
+		normal = length > kEpsilon ? (1.f / length) * gap : fallback;
+		return length;
+	}
+	/*!
+	 @param Aux 
+	 @param contact 
+	 @param capsule 
+	 @param sphere 
+	 @return 
+	*//*__________________________________________________________________________*/
+	bool CollideCapsuleSphere(AuxEngine* Aux, Contact* contact, RigidBody* capsule, RigidBody* sphere)
+	{
+		(void)Aux;		// shut up compiler - parameter present to satisfy signature for fp.
+		Physics::Capsule* shape = (Physics::Capsule*)capsule->mCollideGeom;
+		Real radius = ((Physics::Sphere*)sphere->mCollideGeom)->mRadius;
+		// Quaternion::RotateV() does not rotate; Basis() is the matrix the renderer uses
+		Quaternion turn = capsule->OrientationT1();
+		Vector3D axis = turn.Basis() * Vector3D(0, 0, shape->mHalfLength);
+		Vector3D offset = sphere->PositionT1() - capsule->PositionT1();
+
+		// nearest point of the segment, then out to the capsule's skin
+		Real along = (Real)(offset * axis);
+		Real extent = (Real)(axis * axis);
+		Real t = extent > k0 ? Math::Clamp(along / extent, kN1, k1) : k0;
+		Vector3D normal;
+		Vector3D core = t * axis;
+		Real distance = Separation(offset, core, Vector3D(0, 1, 0), normal);
+		if(distance >= shape->mRadius + radius)
+			return false;
+		return FillShapeSphere(contact, capsule, sphere, capsule->PositionT1() + core + shape->mRadius * normal, normal);
+	}
+	/*!
+	 @param Aux 
+	 @param contact 
+	 @param box 
+	 @param sphere 
+	 @return 
+	*//*__________________________________________________________________________*/
+	bool CollideBoxSphere(AuxEngine* Aux, Contact* contact, RigidBody* box, RigidBody* sphere)
+	{
+		(void)Aux;		// shut up compiler - parameter present to satisfy signature for fp.
+		const Vector3D &half = ((Physics::Box*)box->mCollideGeom)->mHalfExtents;
+		Real radius = ((Physics::Sphere*)sphere->mCollideGeom)->mRadius;
+		Vector3D offset = sphere->PositionT1() - box->PositionT1();
+
+		Vector3D surface, normal;
+		bool inside = true;
+		for(int i = 0; i < 3; ++i)
+		{
+			surface[i] = Math::Clamp((Real)offset[i], (Real)-half[i], (Real)half[i]);
+			inside = inside && surface[i] == offset[i];
+		}
+		if(inside)
+		{
+			// centre inside the box: leave through the nearest face
+			int axis = 0;
+			Real least = (Real)half[0] - Math::Abs((Real)offset[0]);
+			for(int i = 1; i < 3; ++i)
+			{
+				Real depth = (Real)half[i] - Math::Abs((Real)offset[i]);
+				if(depth < least)
+				{
+					least = depth;
+					axis = i;
+				}
+			}
+			normal = Vector3D(0, 0, 0);
+			normal[axis] = offset[axis] < 0 ? kN1 : k1;
+			surface[axis] = normal[axis] * half[axis];
+		}
+		else if(Separation(offset, surface, Vector3D(0, 1, 0), normal) >= radius)
+			return false;
+		return FillShapeSphere(contact, box, sphere, box->PositionT1() + surface, normal);
+	}
+	/*!
+	 @param Aux 
+	 @param contact 
+	 @param hull 
+	 @param sphere 
+	 @return 
+
+	 Tests the sphere against each face plane and takes the one it is
+	 furthest outside; near an edge or a corner of the hull this treats the
+	 hull as slightly larger than it is.
+	*//*__________________________________________________________________________*/
+	bool CollideHullSphere(AuxEngine* Aux, Contact* contact, RigidBody* hull, RigidBody* sphere)
+	{
+		(void)Aux;		// shut up compiler - parameter present to satisfy signature for fp.
+		Physics::ConvexHull* shape = (Physics::ConvexHull*)hull->mCollideGeom;
+		Real radius = ((Physics::Sphere*)sphere->mCollideGeom)->mRadius;
+		Vector3D offset = sphere->PositionT1() - hull->PositionT1();
+		if(shape->mNormals.empty())
+			return false;
+
+		size_t face = 0;
+		Real furthest = -kMax;
+		for(size_t i = 0; i < shape->mNormals.size(); ++i)
+		{
+			Real d = (Real)(offset * shape->mNormals[i]) - shape->mOffsets[i];
+			if(d > furthest)
+			{
+				furthest = d;
+				face = i;
+			}
+		}
+		if(furthest >= radius)
+			return false;
+		Vector3D normal = shape->mNormals[face];
+		return FillShapeSphere(contact, hull, sphere, hull->PositionT1() + offset - (furthest * normal), normal);
+	}
+	/*!
+	 Runs Fn_ with the bodies the other way round, for the (sphere, shape)
+	 order of a pair; the contact still names the shape first.
+	*//*__________________________________________________________________________*/
+	template< CollisionFn Fn_ >
+	bool CollideSwapped(AuxEngine* Aux, Contact* contact, RigidBody* body1, RigidBody* body2)
+	{
+		return Fn_(Aux, contact, body2, body1);
+	}
+	/*!
+	 @param body1 
+	 @param body2 
+	 @return True if the two bodies' bounding spheres, swept over the step,
+			 cannot meet.
+	*//*__________________________________________________________________________*/
+	bool BoundsApart(RigidBody* body1, RigidBody* body2)
+	{
+		Vector3D mid1 = .5f * (body1->PositionT0() + body1->PositionT1());
+		Vector3D mid2 = .5f * (body2->PositionT0() + body2->PositionT1());
+		Real reach = body1->mCollideGeom->Bound() + body2->mCollideGeom->Bound()
+			+ .5f * ((Real)(body1->PositionT1() - body1->PositionT0()).length() + (Real)(body2->PositionT1() - body2->PositionT0()).length());
+		Vector3D gap = mid1 - mid2;
+		return (Real)(gap * gap) > reach * reach;
+	}
+
+	/*!
+	 @param body1 
+	 @param body2 
+	 @param order	Where the pair falls in this step; Collect() sorts on it.
+	 @return 
+
+	 Safe to call from several threads at once between Begin() and Collect().
+	 Callbacks are not raised here; see Dispatch().
+	*//*__________________________________________________________________________*/
+	Contact* Collision::Engine::TestCollision(RigidBody* body1, RigidBody* body2, uint32_t order)
+	{
+        //ProfileFn;
+		const PairTable::Entry &entry = mPairTable.Find(body1->mCollideGeom->Kind(), body2->mCollideGeom->Kind());
+		if(!entry.mCollide || (entry.mReject && entry.mReject(body1, body2)))
+			return 0;
+
+		Contact* ret = 0;
+		uint32_t slot;
+		Contact* contact = mArena.Allocate(slot);
+
+		if(entry.mCollide(mParentPE, contact, body1, body2))
+		{
+			contact->mBody1 = body1;
+			contact->mBody2 = body2;
+			contact->mOrder = order;
+			ret = contact;
+		}
+		else
+		{
+			mArena.Release(slot);
+		}
+
+        return ret;
+	}
+
+	/*!
+	 @param body1 
+	 @param body2 
+	 @param order	As for TestCollision().
+	 @return 
+
+	 TestCollision() for the event solver: sphere pairs are tested for their
+	 first moment of contact rather than for overlap. Same threading rules.
+	*//*__________________________________________________________________________*/
+	Contact* Collision::Engine::TestImpact(RigidBody* body1, RigidBody* body2, uint32_t order)
+	{
+		if(body1->mCollideGeom->Kind() != Physics::kC_Sphere || body2->mCollideGeom->Kind() != Physics::kC_Sphere)
+			return TestCollision(body1, body2, order);
+
+		uint32_t slot;
+		Contact* contact = mArena.Allocate(slot);
+		if(!ImpactSphereSphere(contact, body1, body2))
+		{
+			mArena.Release(slot);
+			return 0;
+		}
+		contact->mOrder = order;
+		return contact;
+	}
+
+	/*!
+	 @param sphere1 
+	 @param sphere2 
+	 @param time	From a SphereSweepBatch lane that hit.
+	 @param normal	The lane's normal.
+	 @param order	As for TestCollision().
+	 @return The contact CollideSphereSphere() would have made for the pair.
+
+	 For sphere pairs already run through SphereSweepBatch; same threading
+	 rules as TestCollision().
+	*//*__________________________________________________________________________*/
+	Contact* Collision::Engine::AddSphereContact(RigidBody* sphere1, RigidBody* sphere2, Real time, const Vector3D &normal, uint32_t order)
+	{
+		uint32_t slot;
+		Contact* contact = mArena.Allocate(slot);
+		FillSphereSphere(contact, sphere1, sphere2, time, normal);
+		contact->mOrder = order;
+		return contact;
+	}
+
+	/*!
+	 @param contact 
+	*//*__________________________________________________________________________*/
+	void _ResolveSpherePlane(Contact* contact)
+	{
+        //ProfileFn;
+		//RigidBody* plane = contact->mBody1;
+		RigidBody* sphere = contact->mBody2;
+		Vector3D temp;
+		Vector3D vContact;
+		Physics::Sphere* spherePtr = (Physics::Sphere*)sphere->mCollideGeom;
+		vContact = -spherePtr->mRadius * contact->mNormal;
+		Vector3D vel1 = sphere->VelocityT1();
+		// a shape moved by hand, like the cue, pushes with its own velocity
+		if(contact->mBody1->Translatable())
+			vel1 -= contact->mBody1->VelocityT1();
+
+		if(sphere->Spinnable())
+		{
+			vel1 += (sphere->AngularVelocityT1() ^ vContact);
+		}
+
+		Real velNormalDir = (Real)(vel1 * contact->mNormal);
+		if(velNormalDir < k0)
+		{
+			Real ImpulseNumerator = -(k1 + CoeffRestSP) * velNormalDir;
+			temp = vContact ^ vel1;//contact->mNormal;
+			if(sphere->InertiaKind() == Physics::kI_Sphere)
+			{
+				temp *= sphere->InertiaTensorInv()[0];
+			}
+			else
+			{
+				temp[0] = temp[0] * sphere->InertiaTensorInv()[0];
+				temp[1] = temp[1] * sphere->InertiaTensorInv()[1];
+				temp[2] = temp[2] * sphere->InertiaTensorInv()[2];
+			}
+			Vector3D temp2 = temp ^ vContact;
+
+			Real ImpulseDenominator = (Real)(sphere->MassInv() + (temp2 * contact->mNormal));
+			Real result = (sphere->MassInv() * ImpulseNumerator) / ImpulseDenominator;
+			Vector3D impulse = result * contact->mNormal;
+			sphere->VelocityT1() += impulse;
+			//sphere->AngularMomentumT1() += .25 * temp2;//contact->mNormal ^ impulse;
+			sphere->AngularVelocityT1() += temp2;// ^ impulse;
+		}
+	}
+	/*!
+	 @param contact 
+	*//*__________________________________________________________________________*/
+	void ResolvePlanePlane(Contact* contact)
+	{
+		contact;	// shut up compiler - parameter present to satisfy signature for fp.
+	}
+	/*!
+	 @param contact 
+	*//*__________________________________________________________________________*/
+	void ResolvePlaneSphere(Contact* contact)
+	{
+        //ProfileFn;
+		//RigidBody* plane = contact->mBody1;
+		RigidBody* sphere = contact->mBody2;
+		Vector3D adjust = sphere->PositionT1() - contact->mPosition;
+		Real residual = (Real)adjust.length();
+		sphere->PositionT1() = contact->mPosition;
+
+		_ResolveSpherePlane(contact);
+
+		adjust = sphere->VelocityT1().normal();
+		sphere->PositionT1() += residual * adjust;
+	}
+	/*!
+	 @param contact 
+	*//*__________________________________________________________________________*/
+	void ResolveSpherePlane(Contact* contact)
+	{
+        //ProfileFn;
+		RigidBody* temp = contact->mBody1;
+		contact->mBody1 = contact->mBody2;
+		contact->mBody2 = temp;
+		contact->mNormal *= kN1;
+		ResolvePlaneSphere(contact);
+	}
+	/*!
+	 @param contact 
+	*//*__________________________________________________________________________*/
+	void ResolveSphereSphere(Contact* contact)
+	{
+        //ProfileFn;
+		RigidBody* body1 = contact->mBody1;
+		RigidBody* body2 = contact->mBody2;
+		Vector3D temp, temp2;
+		Vector3D contact1, contact2;
+		Vector3D velocityA, velocityB, velocityAB;
+
+		Physics::Sphere* sphere1 = (Physics::Sphere*)body1->mCollideGeom;
+		Physics::Sphere* sphere2 = (Physics::Sphere*)body2->mCollideGeom;
+
+		contact1 = -sphere1->mRadius * contact->mNormal;
+		contact2 = sphere2->mRadius * contact->mNormal;
+		velocityA = body1->VelocityT1();
+		velocityB = body2->VelocityT1();
+
+		if(body1->Spinnable())
+		{
+			temp = body1->AngularVelocityT0() ^ contact1;
+			velocityA += temp;
+		}
+		if(body2->Spinnable())
+		{
+			temp = body2->AngularVelocityT0() ^ contact2;
+			velocityB += temp;
+		}
+		velocityAB = velocityA - velocityB; // relative velocity
+		Real velNormalDir = (Real)(velocityAB * contact->mNormal);
+
+		if(velNormalDir < k0) // objects are moving toward one another
+		{
+			Real impulseNumerator = -(k1 + CoeffRestSS) * velNormalDir;
+			temp = contact1 ^ velocityA;//contact->mNormal;
+			if(body1->InertiaKind() == Physics::kI_Sphere)
+			{
+				temp *= body1->InertiaTensorInv()[0];
+			}
+			else
+			{
+				temp[0] = temp[0] * body1->InertiaTensorInv()[0];
+				temp[1] = temp[1] * body1->InertiaTensorInv()[1];
+				temp[2] = temp[2] * body1->InertiaTensorInv()[2];
+			}
+			temp2 = temp ^ contact1;
+			Real impulseDenominator = (Real)(body1->MassInv() + (temp2 * contact->mNormal) + body2->MassInv());
+
+			if(body2->InertiaKind() == Physics::kI_Sphere)
+			{
+				temp *= body2->InertiaTensorInv()[0];
+			}
+			else
+			{
+				temp[0] = temp[0] * body2->InertiaTensorInv()[0];
+				temp[1] = temp[1] * body2->InertiaTensorInv()[1];
+				temp[2] = temp[2] * body2->InertiaTensorInv()[2];
+			}
+			// apply impulse to body1
+			temp2 = temp ^ contact2;
+			impulseDenominator += Real(temp2 * contact->mNormal);
+			Vector3D impulse;
+			Real result = (body1->MassInv() * impulseNumerator) / impulseDenominator;
+			impulse = result * contact->mNormal;
+			body1->VelocityT1() += impulse;
+			// apply opposite impulse to body2
+			Vector3D negImpulse = kN1 * body2->MassInv() * impulse;
+			body2->VelocityT1() += negImpulse;
+
+			temp2 += contact->mNormal ^ impulse;
+			body1->AngularMomentumT1() += .05f * temp2;
+			temp2 *= kN1;
+			body2->AngularMomentumT1() += .05f * temp2;
+		}
+	}
+	/*!
+	 @param contact	A (sphere, shape) contact from CollideSwapped().
+
+	 Resolves it as ResolvePlaneSphere() would the (shape, sphere) contact,
+	 leaving the bodies in their original order.
+	*//*__________________________________________________________________________*/
+	void ResolveSphereShape(Contact* contact)
+	{
+		std::swap(contact->mBody1, contact->mBody2);
+		ResolvePlaneSphere(contact);
+		std::swap(contact->mBody1, contact->mBody2);
+	}
+
+	/*!
+	 @return 
+
+	 Every built-in pair. The plane kinds keep the functions the old fixed
+	 tables gave them; capsules, boxes and hulls are tested against spheres
+	 only, behind a swept bounding sphere check.
+	*//*__________________________________________________________________________*/
+	PairTable::PairTable()
+	{
+		std::memset(mEntries, 0, sizeof(mEntries));
+
+		const uint32_t planes[2] = { Physics::kC_Plane, Physics::kC_BoundedPlane };
+		for(int i = 0; i < 2; ++i)
+		{
+			for(int j = 0; j < 2; ++j)
+				Register(planes[i], planes[j], CollidePlanePlane, ResolvePlanePlane);
+			Register(planes[i], Physics::kC_Sphere, CollidePlaneSphere, ResolvePlaneSphere);
+			Register(Physics::kC_Sphere, planes[i], CollideSpherePlane, ResolveSpherePlane);
+		}
+		Register(Physics::kC_Sphere, Physics::kC_Sphere, CollideSphereSphere, ResolveSphereSphere);
+
+		Register(Physics::kC_Capsule, Physics::kC_Sphere, CollideCapsuleSphere, ResolvePlaneSphere, BoundsApart);
+		Register(Physics::kC_Sphere, Physics::kC_Capsule, CollideSwapped< CollideCapsuleSphere >, ResolveSphereShape, BoundsApart);
+		Register(Physics::kC_Box, Physics::kC_Sphere, CollideBoxSphere, ResolvePlaneSphere, BoundsApart);
+		Register(Physics::kC_Sphere, Physics::kC_Box, CollideSwapped< CollideBoxSphere >, ResolveSphereShape, BoundsApart);
+		Register(Physics::kC_ConvexHull, Physics::kC_Sphere, CollideHullSphere, ResolvePlaneSphere, BoundsApart);
+		Register(Physics::kC_Sphere, Physics::kC_ConvexHull, CollideSwapped< CollideHullSphere >, ResolveSphereShape, BoundsApart);
+	}
+	/*!
+	 @param kind1	eCollisionKind of the pair's first body.
+	 @param kind2	eCollisionKind of the second.
+	 @param collide	Narrowphase; fills the contact and returns true on a hit. 0 drops the pair.
+	 @param resolve	Applies a contact collide found.
+	 @param reject	Optional early out, run first; returns true if the bodies cannot touch.
+	*//*__________________________________________________________________________*/
+	void PairTable::Register(uint32_t kind1, uint32_t kind2, CollisionFn collide, ResolutionFn resolve, RejectFn reject)
+	{
+		ENFORCE(kind1 < Physics::kC_KindCount && kind2 < Physics::kC_KindCount)("Unknown collision kind.");
+		Entry &entry	= mEntries[kind1][kind2];
+		entry.mCollide	= collide;
+		entry.mResolve	= resolve;
+		entry.mReject	= reject;
+	}
+	/*!
+	 @param contact 
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::Resolve(Contact* contact)
+	{
+		mPairTable.Find(contact->mBody1->mCollideGeom->Kind(), contact->mBody2->mCollideGeom->Kind()).mResolve(contact);
+		contact->mBody1->Collided(true);
+		contact->mBody2->Collided(true);
+	}
+	/*!
+	 @return 
+	*//*__________________________________________________________________________*/
+	Collision::Engine::Engine(Physics::AuxEngine* parent):mParentPE(parent)
+	{
+		SetCapacity(2048);
+	}
+	/*!
+	 @return 
+	*//*__________________________________________________________________________*/
+	Collision::Engine::~Engine() 
+	{ 
+	}
+	/*!
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::Begin() {}
+	/*!
+	 Gathers the contacts found since Begin() into mContacts, sorted on the
+	 order they were tested in, so the result does not depend on which
+	 thread found them.
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::Collect()
+	{
+		mContacts.clear();
+		uint32_t count = mArena.Size();
+		for(uint32_t i = 0; i < count; ++i)
+		{
+			Contact* contact = mArena.At(i);
+			if(contact->mBody1)
+				mContacts.push_back(contact);
+		}
+		std::sort(mContacts.begin(), mContacts.end(), ContactOrderLess());
+	}
+	/*!
+	 Raises the callbacks for the collected contacts, one contact at a time
+	 in mContacts order, on the calling thread. Callbacks see the bodies the
+	 way they always have: the plane first for sphere/plane contacts.
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::Dispatch()
+	{
+		for(size_t i = 0; i < mContacts.size(); ++i)
+			Dispatch(mContacts[i]);
+	}
+	/*!
+	 @param contact	Raises this contact's callbacks alone; the event solver
+					calls it as each contact comes due.
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::Dispatch(Contact* contact)
+	{
+		if(contact->mEvent == Contact::kEvent_None)
+			return;
+
+		// put the bodies in the same order as the ids for the callbacks
+		RigidBody* body1 = contact->mBody1;
+		RigidBody* body2 = contact->mBody2;
+		if(body1->Handle() != contact->mID1)
+			std::swap(contact->mBody1, contact->mBody2);
+
+		int first = 0, second = 0;
+		switch(contact->mEvent)
+		{
+		case Contact::kEvent_SpherePlane:
+			first = kCollisionCBSpherePlane;	second = kCallbackRuleSP;			break;
+		case Contact::kEvent_SpherePocket:
+			first = kCollisionCBSpherePocket;	second = kCallbackRuleSBP;			break;
+		case Contact::kEvent_SphereSphere:
+			first = kCallbackRuleSS;			second = kCollisionCBSphereSphere;	break;
+		}
+		Physics::CallbackMap &callbacks = mParentPE->mCallbacks;
+		Physics::CallbackMap::iterator it = callbacks.find(first);
+		if(it != callbacks.end() && it->second != 0)
+			it->second(contact, contact->mBody1, contact->mBody2);
+		it = callbacks.find(second);
+		if(it != callbacks.end() && it->second != 0)
+			it->second(contact, contact->mBody1, contact->mBody2);
+
+		contact->mBody1 = body1;
+		contact->mBody2 = body2;
+	}
+	/*!
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::End()
+	{
+		mContacts.clear();
+		mArena.Reset();
+	}
+	/*!
+	 @param maxContacts 
+	*//*__________________________________________________________________________*/
+	void Collision::Engine::SetCapacity(int maxContacts)
+	{
+		mArena.Reserve((uint32_t)maxContacts);
+	}
+
+	/*!
+	 @return 
+	*//*__________________________________________________________________________*/
+	ContactArena::ContactArena()
+	{
+		for(int i = 0; i < kMaxChunks; ++i)
+			mChunks[i].store(0, std::memory_order_relaxed);
+		mNext.store(0, std::memory_order_relaxed);
+	}
+	/*!
+	 @return 
+	*//*__________________________________________________________________________*/
+	ContactArena::~ContactArena()
+	{
+		for(int i = 0; i < kMaxChunks; ++i)
+			delete [] mChunks[i].load(std::memory_order_relaxed);
+	}
+	/*!
+	 @param index	Chunk number.
+	 @return The chunk, created if this is its first use.
+	*//*__________________________________________________________________________*/
+	Contact* ContactArena::Chunk(uint32_t index)
+	{
+		ENFORCE(index < kMaxChunks)("Contact arena is full.");
+		Contact* chunk = mChunks[index].load(std::memory_order_acquire);
+		if(!chunk)
+		{
+			// racing threads may both build the chunk; the loser throws its copy away
+			Contact* fresh = new Contact[kChunkSize];
+			if(mChunks[index].compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel))
+				chunk = fresh;
+			else
+				delete [] fresh;
+		}
+		return chunk;
+	}
+	/*!
+	 @param slot	Receives the slot of the new contact, for Release().
+	 @return A freshly cleared contact. Safe to call from several threads.
+	*//*__________________________________________________________________________*/
+	Contact* ContactArena::Allocate(uint32_t &slot)
+	{
+		slot = mNext.fetch_add(1, std::memory_order_acq_rel);
+		Contact* contact = Chunk(slot >> kChunkBits) + (slot & kChunkMask);
+		// nothing carries over from the slot's last use, so results do not depend on the slot
+		*contact = Contact();
+		return contact;
+	}
+	/*!
+	 @param slot	A contact that turned out not to be needed.
+
+	 The slot is reclaimed if nothing was allocated after it; otherwise it
+	 stays behind with no bodies and Collect() skips it.
+	*//*__________________________________________________________________________*/
+	void ContactArena::Release(uint32_t slot)
+	{
+		Contact* contact = At(slot);
+		contact->mBody1 = 0;
+		contact->mBody2 = 0;
+		uint32_t expected = slot + 1;
+		mNext.compare_exchange_strong(expected, slot, std::memory_order_acq_rel);
+	}
+	/*!
+	 @param count	Number of contacts to have room for without allocating.
+	*//*__________________________________________________________________________*/
+	void ContactArena::Reserve(uint32_t count)
+	{
+		for(uint32_t i = 0; i < count; i += kChunkSize)
+			Chunk(i >> kChunkBits);
+	}
+
 } // namespace Collision
\ No newline at end of file
@@ -1,84 +1,182 @@
-/*!
-	@file	CollisionEngine.h
-	@author	Scott Smith
-	@date	May 04, 2004
-
-	@brief	Internal definitions.
-
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- *//*__________________________________________________________________________*/
-#pragma once
-
-#ifndef	__COLLISIONENGINE_H__
-#define	__COLLISIONENGINE_H__
-
-#pragma warning( push, 3 )	// shut up the compiler warning 4702
-#pragma warning( disable: 4702 )
-#include <vector>
-#include <list>
-#include <map>
-#pragma warning( pop )
-
-#include "PhysicsDefs.h"
-#include "MathDefs.h"
-#include "RigidBody.h"
-
-const int kCollisionCBSpherePlane	= 1;
-const int kCollisionCBSphereSphere	= 2;
-const int kCollisionCBSpherePocket	= 3;
-const int kCallbackGoneStatic       = 4;
-
-namespace Physics
-{
-	class AuxEngine;
-}
-namespace Collision
-{
-/*!
-	 @class		Contact
-	 @ingroup	Physics Engine Proto
-	 @date		05-05-2004
-	 @author	Scott
-	*//*__________________________________________________________________________*/
-	class Contact
-	{
-	public:
-        Contact():mBody1(0), mBody2(0)	{}
-		Vector3D	mPosition;
-		Vector3D	mNormal;
-		Real		mTime;
-		Real		mDepth;
-		Physics::RigidBody	*mBody1, *mBody2;
-		uint32_t	mID1, mID2;
-	};
-}
-typedef void (*PhysicsCB)(Collision::Contact*, Physics::RigidBody*, Physics::RigidBody* body2);
-
-namespace Collision
-{
-
-/*!
- @class		Engine
- @ingroup	Physics Engine Proto
- @date		05-05-2004
- @author	Scott
-*//*__________________________________________________________________________*/
-class Engine
-{
-public:
-	Engine(Physics::AuxEngine*);
-	~Engine();
-	void SetCapacity(int maxContacts);
-	void Begin(void);
-	Contact* TestCollision(Physics::RigidBody* body1, Physics::RigidBody* body2);
-	void Clear(Contact* contact);
-	void Resolve(Contact* contact);
-	void End(void);
-	std::vector< Contact * > mContacts;
-	std::list< Contact * > mFreePool;
-	Physics::AuxEngine*	mParentPE;
-};
-
-}
-
+/*!
+	@file	CollisionEngine.h
+	@author	Scott Smith
+	@date	May 04, 2004
+
+	@brief	Internal definitions.
+
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+#pragma once
+
+#ifndef	__COLLISIONENGINE_H__
+#define	__COLLISIONENGINE_H__
+
+#pragma warning( push, 3 )	// shut up the compiler warning 4702
+#pragma warning( disable: 4702 )
+#include <atomic>
+#include <vector>
+#include <map>
+#pragma warning( pop )
+
+#include "PhysicsDefs.h"
+#include "MathDefs.h"
+#include "RigidBody.h"
+
+const int kCollisionCBSpherePlane	= 1;
+const int kCollisionCBSphereSphere	= 2;
+const int kCollisionCBSpherePocket	= 3;
+const int kCallbackGoneStatic       = 4;
+const int kCallbackRuleLog          = 4;
+const int kCallbackRuleSS           = 5;
+const int kCallbackRuleSP           = 6;
+const int kCallbackRuleSBP          = 7;
+
+namespace Physics
+{
+	class AuxEngine;
+}
+namespace Collision
+{
+/*!
+	 @class		Contact
+	 @ingroup	Physics Engine Proto
+	 @date		05-05-2004
+	 @author	Scott
+	*//*__________________________________________________________________________*/
+	class Contact
+	{
+	public:
+		/// Which callbacks a contact raises once the narrowphase is done.
+		enum eEvent
+		{
+			kEvent_None = 0,
+			kEvent_SpherePlane,		///< kCollisionCBSpherePlane, then kCallbackRuleSP.
+			kEvent_SpherePocket,	///< kCollisionCBSpherePocket, then kCallbackRuleSBP.
+			kEvent_SphereSphere		///< kCallbackRuleSS, then kCollisionCBSphereSphere.
+		};
+
+        Contact():mPosition(vZero), mNormal(vZero), mTime(k0), mDepth(k0), mBody1(0), mBody2(0), mID1(0), mID2(0), mOrder(0), mEvent(kEvent_None)	{}
+		Vector3D	mPosition;
+		Vector3D	mNormal;
+		Real		mTime;
+		Real		mDepth;		///< How far the bodies overlap at the end of the step; negative if apart.
+		Physics::RigidBody	*mBody1, *mBody2;
+		uint32_t	mID1, mID2;
+		uint32_t	mOrder;		///< Position of the tested pair; contacts are handled in this order.
+		uint8_t		mEvent;		///< An eEvent.
+	};
+
+/*!
+	 @class		ContactArena
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Bump allocator for the contacts of one time step.
+
+		Contacts are handed out from fixed-size chunks, so a contact never
+		moves once allocated; callbacks may hold on to one until the arena is
+		reset. Allocate() is lock-free and may be called from several threads
+		at once. Chunks are created on first use and kept across resets.
+	*//*__________________________________________________________________________*/
+	class ContactArena
+	{
+	public:
+		ContactArena();
+		~ContactArena();
+
+		Contact*	Allocate(uint32_t &slot);
+		void		Release(uint32_t slot);
+		void		Reserve(uint32_t count);
+		void		Reset(void)					{ mNext.store(0, std::memory_order_relaxed); }
+		/// Number of slots handed out since the last reset, released ones included.
+		uint32_t	Size(void) const			{ return mNext.load(std::memory_order_acquire); }
+		Contact*	At(uint32_t slot) const		{ return mChunks[slot >> kChunkBits].load(std::memory_order_acquire) + (slot & kChunkMask); }
+
+	private:
+		enum
+		{
+			kChunkBits	= 8,
+			kChunkSize	= 1 << kChunkBits,
+			kChunkMask	= kChunkSize - 1,
+			kMaxChunks	= 4096			///< Up to a million contacts per step.
+		};
+
+		Contact*	Chunk(uint32_t index);
+
+		// disabled
+		ContactArena(const ContactArena &);
+		ContactArena& operator=(const ContactArena &);
+
+		std::atomic< Contact* >	mChunks[kMaxChunks];
+		std::atomic< uint32_t >	mNext;
+	};
+}
+typedef void (*PhysicsCB)(Collision::Contact*, Physics::RigidBody*, Physics::RigidBody* body2);
+
+namespace Collision
+{
+	typedef	bool (*CollisionFn)(Physics::AuxEngine*, Contact*, Physics::RigidBody* body1, Physics::RigidBody* body2);
+	typedef void (*ResolutionFn)(Contact*);
+	typedef bool (*RejectFn)(Physics::RigidBody* body1, Physics::RigidBody* body2);
+
+/*!
+	 @class		PairTable
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		The narrowphase and resolution functions for each pair of shape kinds.
+
+		Indexed by the two bodies' eCollisionKind, in pair order. An entry
+		may carry a reject function, a cheap bounding volume test run before
+		the narrowphase; pairs with no collide function are never tested.
+		The constructor registers every built-in pair, so a new shape needs
+		only its Register() calls, not another branch in the step.
+	*//*__________________________________________________________________________*/
+	class PairTable
+	{
+	public:
+		struct Entry
+		{
+			CollisionFn		mCollide;
+			ResolutionFn	mResolve;
+			RejectFn		mReject;
+		};
+
+		PairTable();
+		void			Register(uint32_t kind1, uint32_t kind2, CollisionFn collide, ResolutionFn resolve, RejectFn reject = 0);
+		const Entry&	Find(uint32_t kind1, uint32_t kind2) const	{ return mEntries[kind1][kind2]; }
+
+	private:
+		Entry	mEntries[Physics::kC_KindCount][Physics::kC_KindCount];
+	};
+
+/*!
+ @class		Engine
+ @ingroup	Physics Engine Proto
+ @date		05-05-2004
+ @author	Scott
+*//*__________________________________________________________________________*/
+class Engine
+{
+public:
+	Engine(Physics::AuxEngine*);
+	~Engine();
+	void SetCapacity(int maxContacts);
+	void Begin(void);
+	Contact* TestCollision(Physics::RigidBody* body1, Physics::RigidBody* body2, uint32_t order = 0);
+	Contact* AddSphereContact(Physics::RigidBody* sphere1, Physics::RigidBody* sphere2, Real time, const Vector3D &normal, uint32_t order);
+	Contact* TestImpact(Physics::RigidBody* body1, Physics::RigidBody* body2, uint32_t order = 0);
+	void Collect(void);
+	void Dispatch(void);
+	void Dispatch(Contact* contact);
+	void Clear(Contact* contact);
+	void Resolve(Contact* contact);
+	void End(void);
+	std::vector< Contact * > mContacts;		///< Contacts found this step, filled by Collect() in pair order.
+	ContactArena		mArena;
+	PairTable			mPairTable;		///< Which function handles each pair of shape kinds.
+	Physics::AuxEngine*	mParentPE;
+};
+
+}
+
 #endif
\ No newline at end of file
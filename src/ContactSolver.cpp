@@ -0,0 +1,279 @@
+/*!
+	@file	ContactSolver.cpp
+	@date	October 17, 2026
+
+	@brief	Iterative sequential-impulse solver for a step's contacts.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+
+#include "ContactSolver.h"
+#include "CollisionEngine.h"
+#include "RigidBody.h"
+
+using Physics::RigidBody;
+
+namespace Collision
+{
+	/// Closing speed below which a contact rests instead of bouncing.
+	const Real	kBounceSpeed = .5f;
+
+	static inline uint64_t PairKey(const RigidBody* body1, const RigidBody* body2)
+	{
+		uint64_t h1 = body1->Handle(), h2 = body2->Handle();
+		return h1 < h2 ? (h1 << 32) | h2 : (h2 << 32) | h1;
+	}
+
+	struct KeyEqual
+	{
+		template< typename T_ >
+		bool operator()(const T_ &lhs, const T_ &rhs) const	{ return lhs.mKey == rhs.mKey; }
+	};
+
+	static inline Real InertiaInv(RigidBody* body)
+	{
+		return body->Spinnable() && body->InertiaKind() == Physics::kI_Sphere ? (Real)body->InertiaTensorInv()[0] : k0;
+	}
+
+	/*!
+	 @param movingB	False if b is a fixed shape, whose velocity does not count.
+	 @return The velocity of a's contact point less b's.
+	*//*__________________________________________________________________________*/
+	static Vector3D RelativeVelocity(RigidBody* a, RigidBody* b, Vector3D rA, Vector3D rB, bool movingB)
+	{
+		Vector3D spinA = a->AngularVelocityT1();
+		Vector3D v = a->VelocityT1() + (spinA ^ rA);
+		if(movingB)
+		{
+			Vector3D spinB = b->AngularVelocityT1();
+			v -= b->VelocityT1() + (spinB ^ rB);
+		}
+		return v;
+	}
+
+	/*!
+	 @param collide	Its mContacts, in the order they are to be handled.
+	 @param bodies	The store the contacts' bodies live in.
+	 @param dt		Length of the step.
+	 @param params	Iterations, warm starting and the position and friction tuning.
+
+	 Call once per step in place of resolving each contact; contacts with no
+	 sphere in them are resolved one at a time, in order, as they come.
+	*//*__________________________________________________________________________*/
+	void ContactSolver::Solve(Engine &collide, Physics::BodyStore &bodies, Real dt, const Physics::Params &params)
+	{
+		mRows.clear();
+		std::vector< Contact* > &contacts = collide.mContacts;
+		for(size_t i = 0; i < contacts.size(); ++i)
+		{
+			Contact* contact = contacts[i];
+			if(!AddRow(contact))
+			{
+				collide.Resolve(contact);
+				continue;
+			}
+			contact->mBody1->Collided(true);
+			contact->mBody2->Collided(true);
+		}
+
+		// velocities first, warm started from the last step's impulses
+		if(params.mWarmStart)
+		{
+			for(size_t r = 0; r < mRows.size(); ++r)
+				WarmStart(mRows[r]);
+		}
+		for(int it = 0; it < params.mSolverIterations; ++it)
+		{
+			for(size_t r = 0; r < mRows.size(); ++r)
+				SolveVelocity(mRows[r], params.mFriction);
+		}
+
+		// then the overlap, through velocities of its own
+		mPush.resize(bodies.Count());
+		mPushed.clear();
+		for(size_t r = 0; r < mRows.size(); ++r)
+		{
+			mPushed.push_back(mRows[r].mA->Index());
+			if(mRows[r].mInvMassB > k0)
+				mPushed.push_back(mRows[r].mB->Index());
+		}
+		std::sort(mPushed.begin(), mPushed.end());
+		mPushed.erase(std::unique(mPushed.begin(), mPushed.end()), mPushed.end());
+		for(size_t p = 0; p < mPushed.size(); ++p)
+			mPush[mPushed[p]] = Vector3D();
+		for(int it = 0; it < params.mSolverIterations; ++it)
+		{
+			for(size_t r = 0; r < mRows.size(); ++r)
+				SolvePosition(mRows[r], dt, params);
+		}
+		for(size_t p = 0; p < mPushed.size(); ++p)
+			bodies.Body(mPushed[p])->PositionT1() += dt * mPush[mPushed[p]];
+
+		Store();
+	}
+	/*!
+	 @param contact
+	 @return False if the contact has no sphere in it and is not the solver's.
+	*//*__________________________________________________________________________*/
+	bool ContactSolver::AddRow(Contact* contact)
+	{
+		RigidBody* body1 = contact->mBody1;
+		RigidBody* body2 = contact->mBody2;
+		bool sphere1 = body1->mCollideGeom->Kind() == Physics::kC_Sphere;
+		bool sphere2 = body2->mCollideGeom->Kind() == Physics::kC_Sphere;
+		if(!sphere1 && !sphere2)
+			return false;
+
+		// the sphere goes first; shape normals already face it whichever way round the pair is
+		Row row;
+		row.mA = sphere1 ? body1 : body2;
+		row.mB = sphere1 ? body2 : body1;
+		bool sphereB = sphere1 && sphere2;
+		Vector3D n = contact->mNormal;
+		row.mNormal = n;
+
+		Real radiusA = ((Physics::Sphere*)row.mA->mCollideGeom)->mRadius;
+		Real radiusB = sphereB ? ((Physics::Sphere*)row.mB->mCollideGeom)->mRadius : k0;
+		row.mRA = -radiusA * n;
+		row.mRB = radiusB * n;
+		row.mInvMassA = row.mA->Translatable() ? row.mA->MassInv() : k0;
+		row.mInvMassB = sphereB && row.mB->Translatable() ? row.mB->MassInv() : k0;
+		row.mInvInertiaA = InertiaInv(row.mA);
+		row.mInvInertiaB = sphereB ? InertiaInv(row.mB) : k0;
+		row.mMovingB = sphereB || row.mB->Translatable();
+		row.mDepth = contact->mDepth;
+		row.mNormalImpulse = row.mTangentImpulse = row.mPushImpulse = k0;
+		row.mKey = PairKey(body1, body2);
+
+		// two immovable bodies: nothing to solve, but they still count as touched
+		Real massSum = row.mInvMassA + row.mInvMassB;
+		if(massSum <= k0)
+			return true;
+
+		// both lever arms lie along the normal, so only friction turns the bodies
+		row.mNormalMass = k1 / massSum;
+		Vector3D v = RelativeVelocity(row.mA, row.mB, row.mRA, row.mRB, row.mMovingB);
+		Real vn = (Real)(v * n);
+		Vector3D slide = v - vn * n;
+		Real speed = (Real)slide.length();
+		if(speed > kEpsilon)
+		{
+			row.mTangent = (k1 / speed) * slide;
+			row.mTangentMass = k1 / (massSum + row.mInvInertiaA * Math::Sqr(radiusA) + row.mInvInertiaB * Math::Sqr(radiusB));
+		}
+		else
+		{
+			row.mTangent = Vector3D();
+			row.mTangentMass = k0;
+		}
+		Real restitution = sphereB ? CoeffRestSS : CoeffRestSP;
+		row.mBounce = vn < -kBounceSpeed ? -restitution * vn : k0;
+
+		mRows.push_back(row);
+		return true;
+	}
+	/*!
+	 @param impulse	Applied to a, and its opposite to b.
+	*//*__________________________________________________________________________*/
+	static void Apply(RigidBody* a, RigidBody* b, Vector3D rA, Vector3D rB, Real invMassA, Real invMassB,
+					  Real invInertiaA, Real invInertiaB, Vector3D impulse)
+	{
+		if(invMassA > k0)
+			a->VelocityT1() += invMassA * impulse;
+		if(invInertiaA > k0)
+			a->AngularVelocityT1() += invInertiaA * (rA ^ impulse);
+		if(invMassB > k0)
+			b->VelocityT1() -= invMassB * impulse;
+		if(invInertiaB > k0)
+			b->AngularVelocityT1() -= invInertiaB * (rB ^ impulse);
+	}
+	/*!
+	 @param row	Takes the impulses its pair ended the last step with, if any.
+	*//*__________________________________________________________________________*/
+	void ContactSolver::WarmStart(Row &row)
+	{
+		std::vector< Cached >::const_iterator it = std::lower_bound(mCache.begin(), mCache.end(), Cached{ row.mKey, k0, Vector3D() });
+		if(it == mCache.end() || it->mKey != row.mKey)
+			return;
+		Vector3D friction = it->mFriction;
+		row.mNormalImpulse = it->mNormalImpulse;
+		row.mTangentImpulse = row.mTangentMass > k0 ? (Real)(friction * row.mTangent) : k0;
+		Apply(row.mA, row.mB, row.mRA, row.mRB, row.mInvMassA, row.mInvMassB, row.mInvInertiaA, row.mInvInertiaB,
+			  row.mNormalImpulse * row.mNormal + row.mTangentImpulse * row.mTangent);
+	}
+	/*!
+	 @param row
+	 @param friction	Most friction impulse per unit of normal impulse.
+
+	 Moves the row's total impulses towards the ones that stop the bodies
+	 closing (or bounce them apart) and stop them sliding, keeping the
+	 normal one a push and the friction one inside its cone.
+	*//*__________________________________________________________________________*/
+	void ContactSolver::SolveVelocity(Row &row, Real friction)
+	{
+		Vector3D v = RelativeVelocity(row.mA, row.mB, row.mRA, row.mRB, row.mMovingB);
+		Real lambda = (row.mBounce - (Real)(v * row.mNormal)) * row.mNormalMass;
+		Real total = std::max(row.mNormalImpulse + lambda, k0);
+		lambda = total - row.mNormalImpulse;
+		row.mNormalImpulse = total;
+		Apply(row.mA, row.mB, row.mRA, row.mRB, row.mInvMassA, row.mInvMassB, row.mInvInertiaA, row.mInvInertiaB, lambda * row.mNormal);
+
+		if(friction <= k0 || row.mTangentMass <= k0)
+			return;
+		v = RelativeVelocity(row.mA, row.mB, row.mRA, row.mRB, row.mMovingB);
+		lambda = -(Real)(v * row.mTangent) * row.mTangentMass;
+		Real limit = friction * row.mNormalImpulse;
+		total = Math::Clamp(row.mTangentImpulse + lambda, -limit, limit);
+		lambda = total - row.mTangentImpulse;
+		row.mTangentImpulse = total;
+		Apply(row.mA, row.mB, row.mRA, row.mRB, row.mInvMassA, row.mInvMassB, row.mInvInertiaA, row.mInvInertiaB, lambda * row.mTangent);
+	}
+	/*!
+	 @param row
+	 @param dt
+	 @param params	mPositionBias of the overlap past mPositionSlop is removed per step.
+
+	 The push velocities live in mPush and never reach the bodies' real
+	 velocities, so pulling bodies apart does not make them bounce harder.
+	*//*__________________________________________________________________________*/
+	void ContactSolver::SolvePosition(Row &row, Real dt, const Physics::Params &params)
+	{
+		if(row.mDepth <= params.mPositionSlop)
+			return;
+
+		Vector3D pushA = mPush[row.mA->Index()];
+		Vector3D v = pushA;
+		if(row.mInvMassB > k0)
+			v -= mPush[row.mB->Index()];
+		Real target = params.mPositionBias * (row.mDepth - params.mPositionSlop) / dt;
+		Real lambda = (target - (Real)(v * row.mNormal)) * row.mNormalMass;
+		Real total = std::max(row.mPushImpulse + lambda, k0);
+		lambda = total - row.mPushImpulse;
+		row.mPushImpulse = total;
+		mPush[row.mA->Index()] += (row.mInvMassA * lambda) * row.mNormal;
+		if(row.mInvMassB > k0)
+			mPush[row.mB->Index()] -= (row.mInvMassB * lambda) * row.mNormal;
+	}
+	/*!
+	 Keeps this step's impulses, by pair, for the next step's warm start.
+	*//*__________________________________________________________________________*/
+	void ContactSolver::Store(void)
+	{
+		mNext.clear();
+		for(size_t r = 0; r < mRows.size(); ++r)
+		{
+			const Row &row = mRows[r];
+			if(row.mNormalImpulse <= k0)
+				continue;
+			Vector3D tangent = row.mTangent;
+			Cached cached = { row.mKey, row.mNormalImpulse, row.mTangentImpulse * tangent };
+			mNext.push_back(cached);
+		}
+		// a pair with two contacts keeps its first
+		std::stable_sort(mNext.begin(), mNext.end());
+		mNext.erase(std::unique(mNext.begin(), mNext.end(), KeyEqual()), mNext.end());
+		mCache.swap(mNext);
+	}
+}
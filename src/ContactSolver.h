@@ -0,0 +1,97 @@
+/*!
+	@file	ContactSolver.h
+	@date	October 17, 2026
+
+	@brief	Iterative sequential-impulse solver for a step's contacts.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__CONTACTSOLVER_H__
+#define	__CONTACTSOLVER_H__
+
+#include <vector>
+
+#include "PhysicsDefs.h"
+#include "BodyStore.h"
+
+namespace Collision
+{
+	class Contact;
+	class Engine;
+
+	/*!
+	 @class		ContactSolver
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Resolves all of a step's contacts together instead of one at a time.
+
+		Each contact with a sphere in it becomes a row: a normal impulse that
+		may only push, and a friction impulse held to Params::mFriction times
+		the push. Every row is visited Params::mSolverIterations times, each
+		visit correcting its own impulse against what the others have done,
+		so a rack the cue ball drives into settles on the impulses that share
+		the blow out properly, where the one-pass resolve needs many short
+		steps to pass it along.
+
+		The impulses a pair of bodies ended the last step with are kept and
+		applied up front the next step (warm starting), so contacts that last
+		start near their answer. Overlap is pushed out with a separate
+		velocity that moves the bodies but is thrown away afterwards (split
+		impulse), so removing it adds no energy to the bounce.
+
+		Contacts with no sphere in them go to Engine::Resolve() as before.
+	*//*__________________________________________________________________________*/
+	class ContactSolver
+	{
+	public:
+		ContactSolver() {}
+		~ContactSolver() {}
+
+		void	Solve(Engine &collide, Physics::BodyStore &bodies, Real dt, const Physics::Params &params);
+		void	CopyFrom(const ContactSolver &src)	{ mCache = src.mCache; }
+		/// Forgets the impulses kept for warm starting.
+		void	Clear(void)							{ mCache.clear(); }
+
+	private:
+		/// One contact: mA is the sphere pushed along +mNormal, mB the other body.
+		struct Row
+		{
+			Physics::RigidBody	*mA, *mB;
+			Vector3D	mNormal, mTangent;
+			Vector3D	mRA, mRB;				///< Centre to contact point.
+			Real		mInvMassA, mInvMassB;
+			Real		mInvInertiaA, mInvInertiaB;
+			Real		mNormalMass, mTangentMass;
+			Real		mBounce;				///< Normal speed the bounce asks for.
+			Real		mDepth;					///< Overlap at the end of the step.
+			Real		mNormalImpulse, mTangentImpulse, mPushImpulse;
+			uint64_t	mKey;					///< Both bodies' handles.
+			bool		mMovingB;				///< False for a fixed shape, whose velocity is ignored.
+		};
+		/// Impulses a pair ended a step with, sorted on mKey.
+		struct Cached
+		{
+			uint64_t	mKey;
+			Real		mNormalImpulse;
+			Vector3D	mFriction;				///< Friction impulse as a vector; the tangent turns between steps.
+			bool operator<(const Cached &rhs) const	{ return mKey < rhs.mKey; }
+		};
+
+		bool	AddRow(Contact* contact);
+		void	WarmStart(Row &row);
+		void	SolveVelocity(Row &row, Real friction);
+		void	SolvePosition(Row &row, Real dt, const Physics::Params &params);
+		void	Store(void);
+
+		std::vector< Row >		mRows;
+		std::vector< Cached >	mCache;
+		std::vector< Cached >	mNext;			///< Cache being built this step.
+		std::vector< Vector3D >	mPush;			///< Split-impulse velocity by dense index.
+		std::vector< uint32_t >	mPushed;		///< Dense indices with a push to apply.
+	};
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*!
+	@file	FloatMode.cpp
+	@date	October 17, 2026
+
+	@brief	Pins the floating point environment the simulation runs in.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#if defined( _MSC_VER ) && defined( _M_IX86 )
+#include <float.h>
+#define CH_FLOAT_X87	1
+#endif
+
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+#include <xmmintrin.h>
+#define CH_FLOAT_SSE	1
+#endif
+
+#include "FloatMode.h"
+
+namespace Physics
+{
+#if defined( CH_FLOAT_SSE )
+/// MXCSR rounding control, flush-to-zero and denormals-are-zero bits.
+static const unsigned int kSSEModeMask = 0x6000 | 0x8000 | 0x0040;
+#endif
+
+/*!
+ @return
+*//*__________________________________________________________________________*/
+FloatMode::FloatMode() : mSavedSSE(0), mSavedX87(0)
+{
+#if defined( CH_FLOAT_SSE )
+	mSavedSSE = _mm_getcsr();
+	// round to nearest is 0 in the rounding bits; keep the exception masks
+	_mm_setcsr(mSavedSSE & ~kSSEModeMask);
+#endif
+#if defined( CH_FLOAT_X87 )
+	unsigned int unused;
+	_controlfp_s(&mSavedX87, 0, 0);
+	_controlfp_s(&unused, _PC_24 | _RC_NEAR | _DN_SAVE, _MCW_PC | _MCW_RC | _MCW_DN);
+#endif
+}
+/*!
+ @return
+*//*__________________________________________________________________________*/
+FloatMode::~FloatMode()
+{
+#if defined( CH_FLOAT_X87 )
+	unsigned int unused;
+	_controlfp_s(&unused, mSavedX87, _MCW_PC | _MCW_RC | _MCW_DN);
+#endif
+#if defined( CH_FLOAT_SSE )
+	_mm_setcsr(mSavedSSE);
+#endif
+}
+
+}
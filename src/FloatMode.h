@@ -0,0 +1,46 @@
+/*!
+	@file	FloatMode.h
+	@date	October 17, 2026
+
+	@brief	Pins the floating point environment the simulation runs in.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__FLOATMODE_H__
+#define	__FLOATMODE_H__
+
+namespace Physics
+{
+	/*!
+	 @class		FloatMode
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Sets the simulation's rounding and precision for its lifetime.
+
+		Round to nearest with denormals kept (SSE flush-to-zero and
+		denormals-are-zero off), and on 32-bit MSVC the x87 unit at single
+		precision, which is what Direct3D leaves it at unless told otherwise.
+		Anything else (a plugin, a driver, a different device flag) can change
+		these per thread, and then two machines no longer step alike.
+		The previous mode comes back in the destructor.
+	*//*__________________________________________________________________________*/
+	class FloatMode
+	{
+	public:
+		FloatMode();
+		~FloatMode();
+
+	private:
+		// disabled
+		FloatMode(const FloatMode &);
+		FloatMode& operator=(const FloatMode &);
+
+		unsigned int	mSavedSSE;
+		unsigned int	mSavedX87;
+	};
+}
+
+#endif
@@ -0,0 +1,143 @@
+/*!
+	@file	JobPool.cpp
+	@date	October 17, 2026
+
+	@brief	Worker threads for splitting the simulation loops.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+
+#include "FloatMode.h"
+#include "JobPool.h"
+
+namespace Physics
+{
+/*!
+ @param workers	Total threads to use, counting the caller.
+*//*__________________________________________________________________________*/
+JobPool::JobPool(unsigned workers) : mFn(0), mCount(0), mGrain(1), mBusy(0), mJobId(0), mQuit(false)
+{
+	mNext.store(0);
+	Workers(workers);
+}
+/*!
+ @return
+*//*__________________________________________________________________________*/
+JobPool::~JobPool()
+{
+	Stop();
+}
+
+/*!
+ @param count	Total threads to use, counting the caller. 0 means one per core.
+*//*__________________________________________________________________________*/
+void JobPool::Workers(unsigned count)
+{
+	if(count == 0)
+		count = std::max(1u, std::thread::hardware_concurrency());
+	if(count == Workers())
+		return;
+
+	Stop();
+	mQuit = false;
+	for(unsigned i = 1; i < count; ++i)
+		mThreads.push_back(std::thread(&JobPool::WorkerMain, this, mJobId));
+}
+
+/*!
+ @param void
+*//*__________________________________________________________________________*/
+void JobPool::Stop(void)
+{
+	{
+		std::lock_guard< std::mutex > lock(mMutex);
+		mQuit = true;
+	}
+	mWake.notify_all();
+	for(size_t i = 0; i < mThreads.size(); ++i)
+		mThreads[i].join();
+	mThreads.clear();
+}
+
+/*!
+ @param void
+
+ Pulls chunks of the current job until it is used up.
+*//*__________________________________________________________________________*/
+void JobPool::RunChunks(void)
+{
+	for(;;)
+	{
+		uint32_t begin = mNext.fetch_add(mGrain);
+		if(begin >= mCount)
+			break;
+		(*mFn)(begin, std::min(begin + mGrain, mCount));
+	}
+}
+
+/*!
+ @param seen	The last job id issued before this worker started.
+
+ Workers run in the simulation's float mode, whatever the thread that made
+ them was set to.
+*//*__________________________________________________________________________*/
+void JobPool::WorkerMain(uint32_t seen)
+{
+	FloatMode mode;
+	for(;;)
+	{
+		{
+			std::unique_lock< std::mutex > lock(mMutex);
+			while(!mQuit && mJobId == seen)
+				mWake.wait(lock);
+			if(mQuit)
+				return;
+			seen = mJobId;
+		}
+
+		RunChunks();
+
+		std::lock_guard< std::mutex > lock(mMutex);
+		if(--mBusy == 0)
+			mDone.notify_one();
+	}
+}
+
+/*!
+ @param count	Number of items.
+ @param grain	Items per chunk.
+ @param fn		Called with [begin, end) for each chunk, from any thread.
+*//*__________________________________________________________________________*/
+void JobPool::ParallelFor(uint32_t count, uint32_t grain, const RangeFn &fn)
+{
+	if(count == 0)
+		return;
+	grain = std::max(grain, 1u);
+	if(mThreads.empty() || count <= grain)
+	{
+		fn(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard< std::mutex > lock(mMutex);
+		mFn		= &fn;
+		mCount	= count;
+		mGrain	= grain;
+		mNext.store(0);
+		mBusy	= (unsigned)mThreads.size();
+		++mJobId;
+	}
+	mWake.notify_all();
+
+	RunChunks();
+
+	std::unique_lock< std::mutex > lock(mMutex);
+	while(mBusy != 0)
+		mDone.wait(lock);
+	mFn = 0;
+}
+
+}
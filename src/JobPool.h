@@ -0,0 +1,71 @@
+/*!
+	@file	JobPool.h
+	@date	October 17, 2026
+
+	@brief	Worker threads for splitting the simulation loops.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__JOBPOOL_H__
+#define	__JOBPOOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "StdTypes.h"
+
+namespace Physics
+{
+	/*!
+	 @class		JobPool
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		A fixed set of worker threads that run index ranges in parallel.
+
+		ParallelFor() cuts [0, count) into chunks of grain items and hands
+		them out to the workers and the calling thread until none are left,
+		then returns. With one worker everything runs inline on the caller.
+	*//*__________________________________________________________________________*/
+	class JobPool
+	{
+	public:
+		typedef std::function< void (uint32_t begin, uint32_t end) > RangeFn;
+
+		explicit JobPool(unsigned workers = 1);
+		~JobPool();
+
+		void		Workers(unsigned count);
+		unsigned	Workers(void) const			{ return (unsigned)mThreads.size() + 1; }
+		void		ParallelFor(uint32_t count, uint32_t grain, const RangeFn &fn);
+
+	private:
+		void		Stop(void);
+		void		WorkerMain(uint32_t seen);
+		void		RunChunks(void);
+
+		// disabled
+		JobPool(const JobPool &);
+		JobPool& operator=(const JobPool &);
+
+		std::vector< std::thread >	mThreads;
+		std::mutex					mMutex;
+		std::condition_variable		mWake;
+		std::condition_variable		mDone;
+		const RangeFn*				mFn;
+		uint32_t					mCount;
+		uint32_t					mGrain;
+		std::atomic< uint32_t >		mNext;			///< First item not yet handed out.
+		unsigned					mBusy;			///< Workers still inside the current job.
+		uint32_t					mJobId;			///< Bumped for every job, so workers never run one twice.
+		bool						mQuit;
+	};
+}
+
+#endif
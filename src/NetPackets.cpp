@@ -1,21 +1,21 @@
-/*! ========================================================================
-
-      @file    NetPackets.cpp
-      @author  jmp
-      @brief   Implementation of networking packets.
-      
-      (c) 2004 DigiPen (USA) Corporation, all rights reserved.
-      
-    ========================================================================  */
-
-/*                                                                 functions
----------------------------------------------------------------------------- */
-
-#include "main.h"
-
-#include "NetPackets.h"
-
-
-/*                                                                 functions
----------------------------------------------------------------------------- */
-
+/*! ========================================================================
+
+      @file    NetPackets.cpp
+      @author  jmp
+      @brief   Implementation of networking packets.
+      
+      (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+      
+    ========================================================================  */
+
+/*                                                                 functions
+---------------------------------------------------------------------------- */
+
+#include "main.h"
+
+#include "NetPackets.h"
+
+
+/*                                                                 functions
+---------------------------------------------------------------------------- */
+
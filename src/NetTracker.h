@@ -1,31 +1,31 @@
-/*! ========================================================================
-
-      @file    NetTracker.h
-      @author  jmp
-      @brief   Interface to score tracker networking.
-      
-    ======================================================================== 
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- */
-
-/*                                                                     guard
----------------------------------------------------------------------------- */
-
-#ifndef _NET_TRACKER_H_
-#define _NET_TRACKER_H_
-
-
-/*                                                                  includes
----------------------------------------------------------------------------- */
-
-
-
-
-/*                                                                prototypes
----------------------------------------------------------------------------- */
-
-// updating
-void UpdateTrackServer(void);
-
-
+/*! ========================================================================
+
+      @file    NetTracker.h
+      @author  jmp
+      @brief   Interface to score tracker networking.
+      
+    ======================================================================== 
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ */
+
+/*                                                                     guard
+---------------------------------------------------------------------------- */
+
+#ifndef _NET_TRACKER_H_
+#define _NET_TRACKER_H_
+
+
+/*                                                                  includes
+---------------------------------------------------------------------------- */
+
+
+
+
+/*                                                                prototypes
+---------------------------------------------------------------------------- */
+
+// updating
+void UpdateTrackServer(void);
+
+
 #endif  /* _NET_TRACKER_H_ */
\ No newline at end of file
@@ -1,17 +1,17 @@
-/*!
-	@file	RigidBody.h
-	@author	Scott Smith
-	@date	May 04, 2004
-
-	@brief	Internal definitions.
-
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- *//*__________________________________________________________________________*/
-#pragma once
-
-#include "MathDefs.h"
-#include "PhysicsDefs.h"
-#include "PhysicsEngine.h"
-#include "CollisionEngine.h"
-#include "RigidBody.h"
-#include "Spring.h"
\ No newline at end of file
+/*!
+	@file	RigidBody.h
+	@author	Scott Smith
+	@date	May 04, 2004
+
+	@brief	Internal definitions.
+
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+#pragma once
+
+#include "MathDefs.h"
+#include "PhysicsDefs.h"
+#include "PhysicsEngine.h"
+#include "CollisionEngine.h"
+#include "RigidBody.h"
+#include "SpringStore.h"
\ No newline at end of file
@@ -1,103 +1,241 @@
-/*!
-	@file	PhysicsDefs.h
-	@author	Scott Smith
-	@date	May 04, 2004
-
-	@brief	Internal implementation file for physics simulation.
-
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- *//*__________________________________________________________________________*/
-
-#pragma once
-
-#ifndef _PHYSICSDEFS_H_
-#define	_PHYSICSDEFS_H_
-
-#include "MathDefs.h"
-#include "Geometry.hpp"
-#include "Polygon.hpp"
-
-using Geometry::Vector3D;
-
-namespace Physics
-{
-  // config constant defaults
-  const float  kDef_MaxLinearVel  = 100.0f;
-  const float  kDef_MaxAngularVel = 10.0f;
-  const float  kDef_MaxAngularMom = 10;
-  const float  kDef_DragCoeff     = 50;
-
-	///< @enum eInertiaKind	Inertial types for different bodies.
-	enum eInertiaKind	{ kI_Immobile = 0, kI_Sphere };
-	enum eCollisionKind	{ kC_Plane = 0, kC_Sphere, kC_BoundedPlane};
-
-	/*!
-	 @class		Geometry
-	 @ingroup	Physics Engine Proto
-	 @date		05-04-2004
-	 @author	Scott
-	*//*__________________________________________________________________________*/
-	class GeometryType
-	{
-	public:
-		GeometryType() {}
-		virtual ~GeometryType() {}
-		virtual uint32_t Kind() = 0;
-	};
-
-	/*!
-	 @class		Plane
-	 @ingroup	Physics Engine Proto
-	 @date		05-04-2004
-	 @author	Scott
-	*//*__________________________________________________________________________*/
-	class Plane : public GeometryType
-	{
-	public:
-		Plane(const Geometry::Plane3D plane) : mPlane(plane) {}
-		virtual ~Plane() {}
-		uint32_t Kind()	{ return kC_Plane; }
-
-		Geometry::Plane3D mPlane;
-	};
-	/*!
-	 @class		Plane
-	 @ingroup	Physics Engine Proto
-	 @date		05-04-2004
-	 @author	Scott
-	*//*__________________________________________________________________________*/
-	class BoundedPlane : public Plane
-	{
-	public:
-		BoundedPlane():Plane(Geometry::Plane3D()) {}
-		BoundedPlane(const Geometry::Point3D p0, const Geometry::Point3D p1, const Geometry::Point3D p2):Plane(Geometry::Plane3D())
-		{
-            Geometry::Vector3D n = ((p1 - p0).normal() ^ (p2 - p0)).normal();
-			Geometry::Vector3D pt = (p0 - Geometry::Point3D());
-			mPlane = Geometry::Plane3D(n[0], n[1], n[2], -(n * pt));
-			mPolygon[0] = p0;
-			mPolygon[1] = p1;
-			mPolygon[2] = p2;
-		}
-		virtual ~BoundedPlane() {}
-		uint32_t Kind()	{ return kC_BoundedPlane; }
-		Geometry::Triangle3D	mPolygon;
-	};
-	/*!
-	 @class		Sphere
-	 @ingroup	Physics Engine Proto
-	 @date		05-04-2004
-	 @author	Scott
-	*//*__________________________________________________________________________*/
-	class Sphere : public GeometryType
-	{
-	public:
-		Sphere(const Real radius) : mRadius(radius) {}
-		virtual ~Sphere() {}
-		uint32_t Kind()	{ return kC_Sphere; }
-
-		Real mRadius;
-	};
-}	// namespace Physics
-
+/*!
+	@file	PhysicsDefs.h
+	@author	Scott Smith
+	@date	May 04, 2004
+
+	@brief	Internal implementation file for physics simulation.
+
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef _PHYSICSDEFS_H_
+#define	_PHYSICSDEFS_H_
+
+#include <algorithm>
+#include <vector>
+
+#include "MathDefs.h"
+#include "Geometry.hpp"
+#include "Polygon.hpp"
+
+using Geometry::Vector3D;
+
+namespace Physics
+{
+  // config constant defaults
+  const float  kDef_MaxLinearVel  = 100.0f;
+  const float  kDef_MaxAngularVel = 10.0f;
+  const float  kDef_MaxAngularMom = 10;
+  const float  kDef_DragCoeff     = 50;
+  const float  kDef_SleepLinearVel  = 0.05f;
+  const float  kDef_SleepAngularVel = 0.05f;
+  const float  kDef_SleepTime       = 0.25f;
+  const float  kDef_StepRate        = 20.0f;
+  const int    kDef_StepSubsteps    = 5;
+  const int    kDef_MaxSteps        = 4;
+  const int    kDef_MaxEvents       = 64;
+  const float  kDef_MinTimeStep     = 1.0f / 1000.0f;
+  const float  kDef_PositionBias    = 0.8f;
+  const float  kDef_PositionSlop    = 0.01f;
+  const float  kDef_Friction        = 0.1f;
+
+	/*!
+	 @class		Params
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Every tuning value an Engine simulates with.
+
+		Each engine owns one and hands it to the passes that need it, so a
+		step never looks outside its own engine and any number of engines can
+		run side by side. Engine::ConfigParams() fills one from the physics
+		config file; a default-constructed one holds the built-in defaults.
+	*//*__________________________________________________________________________*/
+	struct Params
+	{
+		Params() : mGravity(0, 0, 0), mMinTimeStep(kDef_MinTimeStep),
+			mMaxLinVel(kDef_MaxLinearVel), mMaxAngVel(kDef_MaxAngularVel), mMaxAngMom(kDef_MaxAngularMom), mDragCoeff(kDef_DragCoeff),
+			mSleepLinVel(kDef_SleepLinearVel), mSleepAngVel(kDef_SleepAngularVel), mSleepTime(kDef_SleepTime),
+			mStepRate(kDef_StepRate), mStepSubsteps(kDef_StepSubsteps), mMaxSteps(kDef_MaxSteps),
+			mEventSolver(false), mMaxEvents(kDef_MaxEvents), mSolverIterations(0), mWarmStart(true),
+			mPositionBias(kDef_PositionBias), mPositionSlop(kDef_PositionSlop), mFriction(kDef_Friction), mDeterministic(false)
+		{
+		}
+
+		Vector3D	mGravity;
+		Real		mMinTimeStep;		///< Simulate() splits longer steps into steps this long.
+		Real		mMaxLinVel;
+		Real		mMaxAngVel;
+		Real		mMaxAngMom;
+		Real		mDragCoeff;
+		Real		mSleepLinVel;		///< Bodies slower than this...
+		Real		mSleepAngVel;		///< ...and spinning slower than this...
+		Real		mSleepTime;			///< ...for this long fall asleep. 0 turns sleeping off.
+		Real		mStepRate;			///< Fixed steps per second taken by Advance().
+		int			mStepSubsteps;		///< Update() steps per fixed step.
+		int			mMaxSteps;			///< Most fixed steps one Advance() may take.
+		bool		mEventSolver;		///< Resolve contacts in time order, re-testing after each.
+		int			mMaxEvents;			///< Most contacts re-tested per step before falling back.
+		int			mSolverIterations;	///< Passes of the ContactSolver over a step's contacts; 0 resolves each once, in order.
+		bool		mWarmStart;			///< Start the ContactSolver from the impulses of the step before.
+		Real		mPositionBias;		///< Part of the overlap the ContactSolver removes per step...
+		Real		mPositionSlop;		///< ...beyond this much, which is left alone.
+		Real		mFriction;			///< ContactSolver friction impulse per unit of normal impulse.
+		bool		mDeterministic;		///< Record a state hash after every step.
+	};
+
+	///< @enum eInertiaKind	Inertial types for different bodies.
+	enum eInertiaKind	{ kI_Immobile = 0, kI_Sphere };
+	/// Collision shapes; Collision::PairTable is indexed by these.
+	enum eCollisionKind	{ kC_Plane = 0, kC_Sphere, kC_BoundedPlane, kC_Capsule, kC_Box, kC_ConvexHull, kC_KindCount };
+
+	/*!
+	 @class		Geometry
+	 @ingroup	Physics Engine Proto
+	 @date		05-04-2004
+	 @author	Scott
+
+		The kind and the bounding radius are plain members, set once by the
+		shape's constructor, so the narrowphase reads them without a
+		virtual call.
+	*//*__________________________________________________________________________*/
+	class GeometryType
+	{
+	public:
+		GeometryType(uint32_t kind, Real bound) : mKind(kind), mBound(bound) {}
+		virtual ~GeometryType() {}
+		uint32_t Kind() const	{ return mKind; }
+		/// Radius about the body's position that holds the whole shape; negative if unbounded.
+		Real Bound() const		{ return mBound; }
+		/// A copy of the collision shape, for building an independent engine.
+		virtual GeometryType* Clone() const = 0;
+
+	protected:
+		uint32_t	mKind;
+		Real		mBound;
+	};
+
+	/*!
+	 @class		Plane
+	 @ingroup	Physics Engine Proto
+	 @date		05-04-2004
+	 @author	Scott
+	*//*__________________________________________________________________________*/
+	class Plane : public GeometryType
+	{
+	public:
+		Plane(const Geometry::Plane3D plane) : GeometryType(kC_Plane, -k1), mPlane(plane) {}
+		virtual ~Plane() {}
+		GeometryType* Clone() const	{ return new Plane(*this); }
+
+		Geometry::Plane3D mPlane;
+	};
+	/*!
+	 @class		Plane
+	 @ingroup	Physics Engine Proto
+	 @date		05-04-2004
+	 @author	Scott
+	*//*__________________________________________________________________________*/
+	class BoundedPlane : public Plane
+	{
+	public:
+		BoundedPlane():Plane(Geometry::Plane3D()) { mKind = kC_BoundedPlane; }
+		BoundedPlane(const Geometry::Point3D p0, const Geometry::Point3D p1, const Geometry::Point3D p2):Plane(Geometry::Plane3D())
+		{
+            Geometry::Vector3D n = ((p1 - p0).normal() ^ (p2 - p0)).normal();
+			Geometry::Vector3D pt = (p0 - Geometry::Point3D());
+			mPlane = Geometry::Plane3D(n[0], n[1], n[2], -(n * pt));
+			mPolygon[0] = p0;
+			mPolygon[1] = p1;
+			mPolygon[2] = p2;
+			mKind = kC_BoundedPlane;
+		}
+		virtual ~BoundedPlane() {}
+		GeometryType* Clone() const	{ return new BoundedPlane(*this); }
+		Geometry::Triangle3D	mPolygon;
+	};
+	/*!
+	 @class		Sphere
+	 @ingroup	Physics Engine Proto
+	 @date		05-04-2004
+	 @author	Scott
+	*//*__________________________________________________________________________*/
+	class Sphere : public GeometryType
+	{
+	public:
+		Sphere(const Real radius) : GeometryType(kC_Sphere, radius), mRadius(radius) {}
+		virtual ~Sphere() {}
+		GeometryType* Clone() const	{ return new Sphere(mRadius); }
+
+		Real mRadius;
+	};
+	/*!
+	 @class		Capsule
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		A segment along the body's local Z axis, swept by a radius.
+
+		The segment runs mHalfLength either side of the body's position and
+		turns with the body's orientation; the cue stick is one.
+	*//*__________________________________________________________________________*/
+	class Capsule : public GeometryType
+	{
+	public:
+		Capsule(Real halfLength, Real radius) : GeometryType(kC_Capsule, halfLength + radius), mHalfLength(halfLength), mRadius(radius) {}
+		virtual ~Capsule() {}
+		GeometryType* Clone() const	{ return new Capsule(*this); }
+
+		Real mHalfLength;
+		Real mRadius;
+	};
+	/*!
+	 @class		Box
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		An axis-aligned box centred on the body's position.
+
+		The box moves with the body but does not turn with it.
+	*//*__________________________________________________________________________*/
+	class Box : public GeometryType
+	{
+	public:
+		Box(const Vector3D &halfExtents) : GeometryType(kC_Box, (Real)halfExtents.length()), mHalfExtents(halfExtents) {}
+		virtual ~Box() {}
+		GeometryType* Clone() const	{ return new Box(*this); }
+
+		Vector3D mHalfExtents;
+	};
+	/*!
+	 @class		ConvexHull
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		The space inside a set of face planes, relative to the body's position.
+
+		Each face keeps the points p with mNormals[i] * p <= mOffsets[i]; the
+		normals point out of the hull. Like Box, a hull moves with its body
+		but does not turn. The faces alone define the shape, and they must
+		close it: FitBound() takes the bounding radius from the corners they
+		meet at, and Engine::AddRigidBodyConvexHull() refuses a hull whose
+		faces leave it open or empty.
+	*//*__________________________________________________________________________*/
+	class ConvexHull : public GeometryType
+	{
+	public:
+		ConvexHull() : GeometryType(kC_ConvexHull, k0) {}
+		virtual ~ConvexHull() {}
+		GeometryType* Clone() const	{ return new ConvexHull(*this); }
+
+		void AddFace(const Vector3D &normal, Real offset)
+		{
+			mNormals.push_back(normal.normal());
+			mOffsets.push_back(offset);
+		}
+		bool FitBound(void);
+
+		std::vector< Vector3D >	mNormals;
+		std::vector< Real >		mOffsets;
+	};
+}	// namespace Physics
+
 #endif
\ No newline at end of file
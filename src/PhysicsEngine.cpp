@@ -1,927 +1,1703 @@
-/*!
-	@file	PhysicsEngine.cpp
-	@author	Scott Smith
-	@date	May 04, 2004
-
-	@brief	Internal definitions.
-
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- *//*__________________________________________________________________________*/
-
-
-#include "main.h"
-
-#include "game.h"
-#include "CollisionEngine.h"
-#include "PhysicsEngine.h"
-#include "PhysicsAux.h"
-#include "RigidBody.h"
-#include "Spring.h"
-#include "Quaternion.h"
-#include "log.h"
-#include "profiler.h"
-#include "Player.h"
-#include "RuleSystem.h"
-
-using Geometry::Vector4D;
-using Geometry::Matrix4x4;
-using Physics::AuxEngine;
-
-namespace Physics
-{
-	typedef std::map<int, RigidBody *>	RigidBodyMap;
-	typedef std::map<int, Spring *>		SpringMap;	
-	typedef std::map< int, PhysicsCB > CallbackMap;
-}
-
-static uint32_t UniqueID(void)
-{
-	static uint32_t id = 0;
-	return ++id;
-}
-
-namespace Physics
-{
-	struct CollisionSortPred
-    {
-        bool operator()(const Collision::Contact*lhs, const Collision::Contact*rhs)
-        {
-            return (lhs->mTime < rhs->mTime);
-        }
-    };
-
-} // namespace Physics
-
-void Physics::Engine::Disturb(void)
-{
-	Physics::Engine::mIsStatic = false;
-}
-/*!
- @return 
-*//*__________________________________________________________________________*/
-Physics::Engine::Engine(void): mIsStatic(false),mWasStatic(true)
-{
-    mMaxLinVel = GetConfigValue("Limits","MaxLinearVelocity",Physics::kDef_MaxLinearVel);
-    mMaxAngVel = GetConfigValue("Limits","MaxAngularVelocity",Physics::kDef_MaxAngularVel);
-    mDragCoeff = GetConfigValue("Limits","DragCoeff",Physics::kDef_DragCoeff);
-    mMaxAngMom = GetConfigValue("Limits","MaxAngularMomentum",Physics::kDef_MaxAngularMom);
-	mAuxEngine = new AuxEngine();
-}
-/*!
- @return 
-*//*__________________________________________________________________________*/
-Physics::Engine::~Engine()
-{
-	delete mAuxEngine;
-	mAuxEngine = 0;
-}
-/*!
- @param value 
- @return 
-*//*__________________________________________________________________________*/
-void Physics::Engine::SetGravity(Vector3D value)
-{
-	mAuxEngine->mGravity = value;
-}
-/*!
- @param *cb 
-*//*__________________________________________________________________________*/
-void Physics::Engine::AddPhysicsCallback(int type, PhysicsCB callbackFn)
-{
-	if(callbackFn)
-		mAuxEngine->mCallbacks[type] = callbackFn;
-}
-/*!
- @param radius 
- @return 
-*//*__________________________________________________________________________*/
-uint32_t Physics::Engine::AddRigidBodySphere(Real radius)
-{
-	uint32_t id					= UniqueID();
-	RigidBody* body				= new RigidBody();
-	GeometryType* collide		= 0;
-	collide		= new Sphere(radius);
-	mAuxEngine->mBodies[id]	= body;
-
-	body->InertiaKind(kI_Sphere);
-	body->SetCollisionObject(collide);
-	body->AngVelocityDamp(200.0);
-	return id;
-}
-/*!
- @param plane 
- @return 
-*//*__________________________________________________________________________*/
-uint32_t Physics::Engine::AddRigidBodyPlane(Geometry::Plane3D& plane)
-{
-	uint32_t id = UniqueID();
-	RigidBody* body				= new RigidBody();
-	GeometryType* collide		= 0;
-	collide		= new Plane(plane);
-	
-	mAuxEngine->mBodies[id]	= body;
-
-	body->InertiaKind(kI_Immobile);
-	body->SetCollisionObject(collide);
-	body->Spinnable(false);
-	body->Translatable(false);
-
-	return id;
-}
-/*!
- @param p0 A point on the plane.
- @param p1 A point on the plane.
- @param p2 A point on the plane.
- @return A unique id in the physics simulation.
-*//*__________________________________________________________________________*/
-uint32_t Physics::Engine::AddRigidBodyBoundedPlane(const Physics::BoundedPlane& p)
-{
-	uint32_t id = UniqueID();
-	RigidBody* body				= new RigidBody();
-	GeometryType* collide		= 0;
-
-	collide		= new BoundedPlane(p);
-
-	mAuxEngine->mBodies[id]	= body;
-
-	body->InertiaKind(kI_Immobile);
-	body->SetCollisionObject(collide);
-	body->Spinnable(false);
-	body->Translatable(false);
-
-	return id;
-}
-/*!
- @param id 
- @return 
-*//*__________________________________________________________________________*/
-bool Physics::Engine::RemoveRigidBody(uint32_t id)
-{
-	bool ret = false;
-
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		// remove any springs that may be attached to body being removed.
-		SpringMap::iterator it = mAuxEngine->mSprings.begin();
-		for(; it != mAuxEngine->mSprings.end(); ++it)
-		{
-			Spring* spring = it->second;
-			if(spring->mBody1 == id || spring->mBody2 == id)
-			{
-				RemoveSpring(it->first);
-				it = mAuxEngine->mSprings.begin();
-			}
-		}
-		RigidBody* body = mAuxEngine->mBodies[id];
-		mAuxEngine->mBodies.erase(id);
-		delete body;
-		ret = true;
-	}
-
-	return ret;
-}
-/*!
- @param void 
-*//*__________________________________________________________________________*/
-void Physics::Engine::RemoveAll(void)
-{
-	RigidBodyMap::iterator	bIt;
-	SpringMap::iterator		sIt;
-
-	for(bIt = mAuxEngine->mBodies.begin(); bIt != mAuxEngine->mBodies.end(); ++bIt)
-	{
-		RigidBody* body = bIt->second;
-		delete body;
-	}
-	for(sIt = mAuxEngine->mSprings.begin(); sIt != mAuxEngine->mSprings.end(); ++sIt)
-	{
-		Spring* spring = sIt->second;
-		delete spring;
-	}
-	mAuxEngine->mBodies.clear();
-	mAuxEngine->mSprings.clear();
-}
-/*!
- @param void 
- @return 
-*//*__________________________________________________________________________*/
-uint32_t Physics::Engine::AddSpring(void)
-{
-	uint32_t id					= UniqueID();
-	Spring* spring				= new Spring();
-	mAuxEngine->mSprings[id]	= spring;
-
-	return id;
-}
-/*!
- @param uint32_t 
- @return 
-*//*__________________________________________________________________________*/
-bool Physics::Engine::RemoveSpring(uint32_t id)
-{
-	bool ret = false;
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		mAuxEngine->mSprings.erase(id);
-		delete spring;
-		ret = true;
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::RigidBodyBool(uint32_t id, eRigidBodyBool prop, bool value)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propActive:
-			body->Active(value);		break;
-		case propUseGravity:
-			body->Gravity(value);		break;
-		case propCollidable:
-			body->Collidable(value);	break;
-		case propSpinnable:
-			body->Spinnable(value);		break;
-		case propTranslatable:
-			body->Translatable(value);	break;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-bool Physics::Engine::RigidBodyBool(uint32_t id, eRigidBodyBool prop)
-{
-	bool ret = false;
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propActive:
-			ret = body->Active();		break;
-		case propUseGravity:
-			ret = body->Gravity();		break;
-		case propCollidable:
-			ret = body->Collidable();	break;
-		case propSpinnable:
-			ret = body->Spinnable();	break;
-		case propTranslatable:
-			ret = body->Translatable();	break;
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::RigidBodyScalar(uint32_t id, eRigidBodyScalar prop, Real value)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propAngVelDamp:
-			body->AngVelocityDamp(value);		break;
-		case propLinVelDamp:
-			body->LinVelocityDamp(value);		break;
-		case propMass:
-			body->Mass(value);					break; 
-			// mass must be greater than .2 for accuracy
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-Real Physics::Engine::RigidBodyScalar(uint32_t id, eRigidBodyScalar prop)
-{
-	Real ret = k0;
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propAngVelDamp:
-			ret = body->AngVelocityDamp();		break;
-		case propLinVelDamp:
-			ret = body->LinVelocityDamp();		break;
-		case propMass:
-			ret = body->Mass();					break; 
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::RigidBodyVector3D(uint32_t id, eRigidBodyVector prop, Vector3D value)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propDimensions:
-			body->mExtent = value;				break;
-		case propPosition:
-			body->mStateT1.mPosition = value;	break;
-		case propVeloctity:
-			body->mStateT1.mVelocity = value;	break;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-Vector3D Physics::Engine::RigidBodyVector3D(uint32_t id, eRigidBodyVector prop)
-{
-	Vector3D ret = vZero;
-	
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propDimensions:
-			ret = body->mExtent;				break;
-		case propPosition:
-			ret = body->mStateT1.mPosition;		break;
-		case propVeloctity:
-			ret = body->mStateT1.mVelocity ;	break;
-		}
-	}
-
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::RigidBodyQuaternion(uint32_t id, eRigidBodyQuaternion prop, Quaternion value)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propOrientation:
-			body->mStateT1.mOrientation = value;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-Quaternion Physics::Engine::RigidBodyQuaternion(uint32_t id, eRigidBodyQuaternion prop)
-{
-	Quaternion ret = qZero;
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		switch(prop)
-		{
-		case propOrientation:
-			ret = body->mStateT1.mOrientation;
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @return 
-*//*__________________________________________________________________________*/
-Matrix4x4 Physics::Engine::RigidBodyTransformationMatrix(uint32_t id)
-{
-	Matrix4x4 ret;
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		if(body->Spinnable())
-		{
-			ret = body->mStateT1.mOrientation.Basis();
-		}
-		else
-		{
-			ret.reset();
-		}
-		ret[0][3] = body->mStateT1.mPosition[0];
-		ret[1][3] = body->mStateT1.mPosition[1];
-		ret[2][3] = body->mStateT1.mPosition[2];
-		
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::SpringBool(uint32_t id, eSpringBool prop, bool value)
-{
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propSpringCompressible:
-			spring->mCompressible = value;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-bool Physics::Engine::SpringBool(uint32_t id, eSpringBool prop)
-{
-	bool ret = false;
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propSpringCompressible:
-			ret = spring->mCompressible;	break;
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::SpringBody(uint32_t id, eSpringID prop, uint32_t value)
-{
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propBody1:
-			if(mAuxEngine->mBodies.count(value) != 0)
-			{
-				spring->mBody1 = value;
-				spring->mBodyPtr1 = mAuxEngine->mBodies[value];
-			}
-			else
-			{
-				char buf[100] = {0};
-				sprintf(buf, "Can't attach spring to nonexistant body. Spring: %d, Body: %d", id, value); 
-			}
-			break;
-		case propBody2:
-			if(mAuxEngine->mBodies.count(value) != 0)
-			{
-				spring->mBody2 = value;
-				spring->mBodyPtr2 = mAuxEngine->mBodies[value];
-			}
-			else
-			{
-				char buf[100] = {0};
-				sprintf(buf, "Can't attach spring to nonexistant body. Spring: %d, Body: %d", id, value); 
-			}
-			break;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-uint32_t Physics::Engine::SpringBody(uint32_t id, eSpringID prop)
-{
-	uint32_t ret = 0;
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propBody1:
-			ret = spring->mBody1; break;
-		case propBody2:
-			ret = spring->mBody2; break;
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::SpringScalar(uint32_t id, eSpringScalar prop, Real value)
-{
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propSpringStiffness:
-			spring->mStiffness = value;		break;
-		case propSpringRestLength:
-			spring->mRestLength = value;
-			spring->mPrevLength = value;	break;
-		case propSpringDamping:
-			spring->mDamping = value;
-			if(value > k1 || value < k0)
-			{
-				char buf[100] = {0};
-				sprintf(buf, "Illegal damping value: %f.  0 for no damping, 1 for critical damping.", value);
-			}
-			break;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-Real Physics::Engine::SpringScalar(uint32_t id, eSpringScalar prop)
-{
-	Real ret = k0;
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propSpringStiffness:
-			ret = spring->mStiffness;		break;
-		case propSpringRestLength:
-			ret = spring->mRestLength;		break;
-		case propSpringDamping:
-			ret = spring->mDamping;			break;
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @param prop 
- @param value 
-*//*__________________________________________________________________________*/
-void Physics::Engine::SpringVector(uint32_t id, eSpringVector prop, Vector3D value)
-{
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propAttachPoint1:
-			spring->mPos1 = value;
-			spring->mCenterAttach1 = (value * value) <= kEpsilon ? true : false; // true if zero vector
-			break;
-		case propAttachPoint2:
-			spring->mPos2 = value;
-			spring->mCenterAttach2 = (value * value) <= kEpsilon ? true : false; // true if zero vector
-			break;
-		}
-	}
-}
-/*!
- @param id 
- @param prop 
- @return 
-*//*__________________________________________________________________________*/
-Vector3D Physics::Engine::SpringVector(uint32_t id, eSpringVector prop)
-{
-	Vector3D ret = vZero;
-	if(mAuxEngine->mSprings.count(id) != 0)
-	{
-		Spring* spring = mAuxEngine->mSprings[id];
-		switch(prop)
-		{
-		case propAttachPoint1:
-			ret = spring->mPos1;	break;
-		case propAttachPoint2:
-			ret = spring->mPos2;	break;
-		}
-	}
-	return ret;
-}
-/*!
- @param id 
- @param force 
-*//*__________________________________________________________________________*/
-void Physics::Engine::AddImpulse(uint32_t id, Vector3D force)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		if(body->Translatable())
-			body->mAccum.AddForce(force);
-	}
-}
-/*!
- @param id 
- @param torque 
-*//*__________________________________________________________________________*/
-void Physics::Engine::AddTwist(uint32_t id, Vector3D torque)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		if(body->Spinnable())
-			body->mAccum.AddTorque(torque);
-	}
-}
-/*!
- @param id 
-*//*__________________________________________________________________________*/
-void Physics::Engine::StopMoving(uint32_t id)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		if(body->Translatable())
-		{
-			body->mAccum.mForce = vZero;
-			body->mStateT0.mVelocity = vZero;
-			body->mStateT1.mVelocity = vZero;
-		}
-	}
-}
-/*!
- @param id 
-*//*__________________________________________________________________________*/
-void Physics::Engine::StopSpinning(uint32_t id)
-{
-	if(mAuxEngine->mBodies.count(id) != 0)
-	{
-		RigidBody* body = mAuxEngine->mBodies[id];
-		//if(body->Spinnable())
-		{
-			body->mAccum.mTorque = vZero;
-			body->mStateT0.mAngularVelocity = vZero;
-			body->mStateT1.mAngularVelocity = vZero;
-			body->mStateT0.mAngularMomentum = vZero;
-			body->mStateT1.mAngularMomentum = vZero;
-		}
-	}
-}
-/*!
- @param dt 
-*//*__________________________________________________________________________*/
-void Physics::Engine::SetMinTimeStep(Real dt)
-{
-	mAuxEngine->mMinTimeStep = dt;
-}
-/*!
- @param dt 
-*//*__________________________________________________________________________*/
-void Physics::Engine::Update(Real dt, int steps)
-{
-//ProfileFn;
-   // LogS->Post(__FUNCTION__);
-   // static int call_count = 0;
-    if(AtRest())
-            return;
-    
-    mIsStatic = true;
-    //steps *= 3;
-		// fluid drag constant
-		//const Real b = 50.0;
-		//RigidBodyMap::iterator bIt = mAuxEngine->mBodies.begin();
-		//volatile int staticLinearCount = 0;
-		//volatile int staticAngularCount = 0;
-		volatile int activeCount = 0;
-		//volatile int SpinnableCount = 0;
-//		for(; bIt != mAuxEngine->mBodies.end(); ++bIt)
-
-        std::vector< Ball * > &balls = Game::Get()->GetPlayfield()->mBalls;
-        
-        for(unsigned int i = 0; i < balls.size(); ++i)
-		{
-            int id = balls[i]->ID();
-            
-            Vector3D v = RigidBodyVector3D(id, Physics::Engine::eRigidBodyVector::propVeloctity);
-            if(v.length() > .2)
-            {
-                Physics::Engine::AddImpulse(id, (-mDragCoeff/steps) * v);
-				++activeCount;
-                mIsStatic = false;
-            }
-            else if(v.length() > kEpsilon)
-			{
-					StopMoving(id);
-            }
-        }
-		
-
-		if(activeCount)
-		{
-            for(int i = 0; i < steps; ++i)
-	    	{
-			    Simulate(dt/steps);
-
-    		}
-			
-	    }
-        else if(!mWasStatic)
-        {
-           mAuxEngine->mCallbacks[kCallbackGoneStatic](0,0,0);
-        }	
-		
-		
-		mWasStatic = mIsStatic;
-}
-/*!
- @param void 
- @return 
-*//*__________________________________________________________________________*/
-bool Physics::Engine::AtRest(void)const { return mIsStatic; }
-void Physics::Engine::AtRest(bool b) { mIsStatic = b; }
-/*!
- @param void 
-*//*__________________________________________________________________________*/
-void Physics::Engine::StopAll(void)
-{
-	RigidBodyMap::iterator bIt = mAuxEngine->mBodies.begin();
-	for(; bIt != mAuxEngine->mBodies.end(); ++bIt)
-	{
-		StopMoving(bIt->first);
-		StopSpinning(bIt->first);
-	}
-}
-uint32_t	Physics::Engine::Kind(uint32_t id)const
-{
-	return (mAuxEngine->mBodies[id])->mCollideGeom->Kind();
-}
-/*!
- @param dt 
-*//*__________________________________________________________________________*/
-void Physics::Engine::Simulate(Real dt)
-{	ProfileFn;
-	//LogS->Post(__FUNCTION__);
-	int steps;
-	if(dt > mAuxEngine->mMinTimeStep)
-	{
-		steps = 1 + (int)(dt / mAuxEngine->mMinTimeStep);
-		dt /= (float)steps;
-	}
-	else
-	{
-		steps = 1;
-	}
-
-	// reset for current timestep
-	for(int i = 0; i < steps; ++i)
-	{
-		RigidBodyMap::iterator	bIt;
-		SpringMap::iterator		sIt;
-
-		for(bIt = mAuxEngine->mBodies.begin(); bIt != mAuxEngine->mBodies.end(); ++bIt)
-		{
-			RigidBody *body = bIt->second;
-			if(body->Active())
-			{
-				body->ResetForNextTimeStep();
-			}
-		}
-	
-
-		// loop over all objects
-		for(bIt = mAuxEngine->mBodies.begin(); bIt != mAuxEngine->mBodies.end(); ++bIt)
-		{
-			RigidBody *body = bIt->second;
-			if(body->Active())
-				body->Integrate1(dt);
-		}
-
-		// loop over all springs and apply forces to objects
-		for(sIt = mAuxEngine->mSprings.begin(); sIt != mAuxEngine->mSprings.end(); ++sIt)
-		{
-			Spring* spring	= sIt->second;
-			Vector3D Pos1 = spring->mBodyPtr1->mStateT1.mPosition;
-			Vector3D Pos2 = spring->mBodyPtr2->mStateT1.mPosition;
-			Vector3D dir = Pos1 - Pos2;
-			Real length = (Real)(dir.length());
-			Real x = length - spring->mRestLength;
-			if(spring->mCompressible || (x > k0))
-			{
-				Real force = spring->mStiffness * x;
-				Real v = spring->mPrevLength - x;
-				force += v * spring->mDamping;
-				spring->mPrevLength = length;
-				spring->mBodyPtr1->mAccum.mForce += -force * dir;
-				spring->mBodyPtr2->mAccum.mForce += force * dir;
-			}
-		
-		}
-		// loop over all objects again after spring forces
-		for(bIt = mAuxEngine->mBodies.begin(); bIt != mAuxEngine->mBodies.end(); ++bIt)
-		{
-			RigidBody* body	= bIt->second;
-			if(body->Active())
-				body->Integrate2(dt, mAuxEngine->mGravity);
-		}
-
-		// loop over all objects, detect and resolve collisions
-		mAuxEngine->mCollisionEngine.Begin();
-
-        for(bIt = mAuxEngine->mBodies.begin(); bIt != mAuxEngine->mBodies.end(); ++bIt)
-		{
-			RigidBody* body1 = bIt->second;
-            // create a vector by which to displace all of the other balls, to simplify the 
-            // reference frame
-            Geometry::Vector3D disp = -body1->mStateT0.mVelocity;
-            // this will be the new location of the balls, if it is a ball at all :)
-            Geometry::Vector3D pos1;
-            Geometry::Vector3D pos2;
-            Geometry::Vector3D vel;
-
-			if(body1->Collidable())
-			{
-                // start looking through the list from where we are, not from the beginning
-
-				RigidBodyMap::iterator bIt2 = bIt;
-				++bIt2;
-				for(; bIt2 != mAuxEngine->mBodies.end(); ++bIt2)
-				{
-					RigidBody* body2 = bIt2->second;
-                    // test that the body can be collided with
-                    if(!body2->Collidable())
-                        continue;
-                    
-                    // if the objects are not moving, don't test the collision
-                    if(body1->mStateT0.mVelocity.length() < kEpsilon && body2->mStateT0.mVelocity.length() < kEpsilon)
-                        continue;
-
-                    // minimize sphere collision tests
-                    if(body1->mCollideGeom->Kind() == Physics::kC_Sphere && body2->mCollideGeom->Kind() == Physics::kC_Sphere)
-                    {
-                        // the position of body 1 at the beginning of the frame
-                        pos1 = body1->mStateT0.mPosition;
-                        // the velocity of body2 in body1 reference frame
-                        vel = body2->mStateT0.mVelocity + disp;
-                        // the position of body2 in body1 reference frame
-                        pos2 = body2->mStateT0.mPosition + vel * dt;
-                        // check body distance for each axis, bail out if too far
-                        if(abs(pos1[2] - pos2[2]) >= 3.f)
-                            continue;
-                        if(abs(pos1[0] - pos2[0]) >= 3.f)
-                            continue;
-                        if(abs(pos1[1] - pos2[1]) >= 3.f)
-                            continue;
-                    }
-                    // passed the tests, check for collision
-					mAuxEngine->mCollisionEngine.TestCollision(body1, body2);
-				}
-			}
-		}
-        
-  
-        std::sort(mAuxEngine->mCollisionEngine.mContacts.begin(), mAuxEngine->mCollisionEngine.mContacts.end(), CollisionSortPred());
-
-		std::vector< Collision::Contact* >::iterator cIt;
-        
-		// get the player, and populate the contact list
-
-        for(cIt = mAuxEngine->mCollisionEngine.mContacts.begin(); cIt != mAuxEngine->mCollisionEngine.mContacts.end(); ++cIt)
-		{
-			// resolve the collisions for this iteration
-			mAuxEngine->mCollisionEngine.Resolve(*cIt);
-		}
-    	
-		// clean up collision free list
-		mAuxEngine->mCollisionEngine.End();
-
-		for(bIt = mAuxEngine->mBodies.begin(); bIt != mAuxEngine->mBodies.end(); ++bIt)
-		{
-			RigidBody* body = bIt->second;
-			body->Renormalize();
-		}
-       
-      
-	}
-
-
-
-
-}
-
+/*!
+	@file	PhysicsEngine.cpp
+	@author	Scott Smith
+	@date	May 04, 2004
+
+	@brief	Internal definitions.
+
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+
+#if defined( _WIN32 )
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "CollisionEngine.h"
+#include "PhysicsEngine.h"
+#include "PhysicsAux.h"
+#include "RigidBody.h"
+#include "Quaternion.h"
+#include "SphereKernels.h"
+#include "FloatMode.h"
+#include "profiler.h"
+
+using Geometry::Vector4D;
+using Geometry::Matrix4x4;
+using Physics::AuxEngine;
+
+namespace Physics
+{
+	typedef std::map< int, PhysicsCB > CallbackMap;
+}
+
+static const char *kPhysicsConfigFile = "data/config/physics.ini";
+
+/// Leads every WorldSnapshot; bump the version when the layout changes.
+static const uint32_t kSnapshotMagic	= 0x53574843;	// "CHWS"
+static const uint32_t kSnapshotVersion	= 3;
+
+namespace
+{
+	struct SnapshotHeader
+	{
+		uint32_t	mMagic;
+		uint32_t	mVersion;
+		uint32_t	mSpringCount;
+		uint8_t		mIsStatic;
+		uint8_t		mWasStatic;
+		uint8_t		mPad[2];
+	};
+
+	struct SpringRecord
+	{
+		uint32_t	mId;
+		uint32_t	mBody1, mBody2;
+		Real		mStiffness, mDamping, mRestLength, mPrevLength;
+		Vector3D	mPos1, mPos2;
+		uint8_t		mCompressible, mCenterAttach1, mCenterAttach2, mPad;
+	};
+}
+
+/// Bodies per work item in the integration passes.
+static const uint32_t kIntegrateGrain = 256;
+/// Candidate pairs per work item in the narrowphase.
+static const uint32_t kNarrowphaseGrain = 128;
+
+/*!
+ @param collide
+ @param bodies
+ @param pairs
+ @param batch	Sphere pairs gathered from pairs; emptied.
+ @param order	Index into pairs of each lane of batch.
+*//*__________________________________________________________________________*/
+static void RunSphereBatch(Collision::Engine &collide, Physics::BodyStore &bodies, const std::vector< Collision::Pair > &pairs,
+						   Collision::SphereSweepBatch &batch, const uint32_t* order)
+{
+	if(batch.Run() != 0)
+	{
+		for(uint32_t lane = 0; lane < batch.Count(); ++lane)
+		{
+			if(!batch.Hit(lane))
+				continue;
+			const Collision::Pair &pair = pairs[order[lane]];
+			collide.AddSphereContact(bodies.Body(pair.mBody1), bodies.Body(pair.mBody2), batch.Time(lane), batch.Normal(lane), order[lane]);
+		}
+	}
+	batch.Clear();
+}
+
+#if !defined( _WIN32 )
+/*!
+ @param s 
+ @return s, with leading and trailing whitespace removed.
+*//*__________________________________________________________________________*/
+static std::string TrimConfigToken(const std::string &s)
+{
+	std::string::size_type first = s.find_first_not_of(" \t\r\n");
+	if(first == std::string::npos)
+		return std::string();
+	std::string::size_type last = s.find_last_not_of(" \t\r\n");
+	return s.substr(first, last - first + 1);
+}
+/*!
+ @param lhs 
+ @param rhs 
+ @return True if the strings match, ignoring case (INI files are case-insensitive).
+*//*__________________________________________________________________________*/
+static bool ConfigTokenEqual(const std::string &lhs, const std::string &rhs)
+{
+	if(lhs.size() != rhs.size())
+		return false;
+	for(std::string::size_type i = 0; i < lhs.size(); ++i)
+	{
+		if(std::tolower((unsigned char)lhs[i]) != std::tolower((unsigned char)rhs[i]))
+			return false;
+	}
+	return true;
+}
+#endif
+
+namespace Physics
+{
+	/// Earliest first; contacts at the same moment in pair order, so ties
+	/// resolve the same way whatever the sort or the standard library.
+	struct EventLess
+	{
+		bool operator()(const Collision::Contact* lhs, const Collision::Contact* rhs) const
+		{
+			if(lhs->mTime != rhs->mTime)
+				return lhs->mTime < rhs->mTime;
+			return lhs->mOrder < rhs->mOrder;
+		}
+	};
+
+	/// Part of an event's contact list that a resolved contact has made stale.
+	struct EventTouches
+	{
+		EventTouches(const RigidBody* body1, const RigidBody* body2) : mBody1(body1), mBody2(body2) {}
+		bool operator()(const Collision::Contact* contact) const
+		{
+			return contact->mBody1 == mBody1 || contact->mBody1 == mBody2
+				|| contact->mBody2 == mBody1 || contact->mBody2 == mBody2;
+		}
+		const RigidBody	*mBody1, *mBody2;
+	};
+
+} // namespace Physics
+
+/*!
+ @param sec  The section in which the value is located.
+ @param key  The value's key.
+ @param def  The default value to use if the key is not found.
+ @return The raw string value of the key in the physics configuration file.
+*//*__________________________________________________________________________*/
+std::string Physics::Engine::GetConfigString(const std::string &sec,const std::string &key,const std::string &def)
+{
+#if defined( _WIN32 )
+char  res_val[256];
+
+	::GetPrivateProfileString(sec.c_str(),key.c_str(),def.c_str(),res_val,256,kPhysicsConfigFile);
+	return (res_val);
+#else
+	// Minimal INI reader with GetPrivateProfileString semantics, so headless
+	// builds pick up the same tuning as the client.
+	std::ifstream  file(kPhysicsConfigFile);
+	std::string    line;
+	bool           inSection = false;
+
+	while(std::getline(file, line))
+	{
+		line = TrimConfigToken(line);
+		if(line.empty() || line[0] == ';')
+			continue;
+		if(line[0] == '[')
+		{
+			std::string::size_type close = line.find(']');
+			inSection = ConfigTokenEqual(TrimConfigToken(line.substr(1, close - 1)), sec);
+			continue;
+		}
+		std::string::size_type eq = line.find('=');
+		if(inSection && eq != std::string::npos && ConfigTokenEqual(TrimConfigToken(line.substr(0, eq)), key))
+			return TrimConfigToken(line.substr(eq + 1));
+	}
+	return def;
+#endif
+}
+
+void Physics::Engine::Disturb(void)
+{
+	Physics::Engine::mIsStatic = false;
+}
+/*!
+ @return The tuning in the physics config file, with the built-in defaults
+		 for anything it leaves out.
+*//*__________________________________________________________________________*/
+Physics::Params Physics::Engine::ConfigParams(void)
+{
+	Params params;
+	params.mMaxLinVel		= GetConfigValue("Limits","MaxLinearVelocity",params.mMaxLinVel);
+	params.mMaxAngVel		= GetConfigValue("Limits","MaxAngularVelocity",params.mMaxAngVel);
+	params.mDragCoeff		= GetConfigValue("Limits","DragCoeff",params.mDragCoeff);
+	params.mMaxAngMom		= GetConfigValue("Limits","MaxAngularMomentum",params.mMaxAngMom);
+	params.mSleepLinVel		= GetConfigValue("Sleep","LinearVelocity",params.mSleepLinVel);
+	params.mSleepAngVel		= GetConfigValue("Sleep","AngularVelocity",params.mSleepAngVel);
+	params.mSleepTime		= GetConfigValue("Sleep","Time",params.mSleepTime);
+	params.mStepRate		= GetConfigValue("Step","Rate",params.mStepRate);
+	params.mStepSubsteps	= GetConfigValue("Step","Substeps",params.mStepSubsteps);
+	params.mMaxSteps		= GetConfigValue("Step","MaxSteps",params.mMaxSteps);
+	params.mEventSolver		= GetConfigValue("Solver","Events",0) != 0;
+	params.mMaxEvents		= GetConfigValue("Solver","MaxEvents",params.mMaxEvents);
+	params.mSolverIterations	= GetConfigValue("Solver","Iterations",params.mSolverIterations);
+	params.mWarmStart		= GetConfigValue("Solver","WarmStart",1) != 0;
+	params.mPositionBias	= GetConfigValue("Solver","PositionBias",params.mPositionBias);
+	params.mPositionSlop	= GetConfigValue("Solver","PositionSlop",params.mPositionSlop);
+	params.mFriction		= GetConfigValue("Solver","Friction",params.mFriction);
+	params.mMinTimeStep		= GetConfigValue("Step","MinTimeStep",params.mMinTimeStep);
+	params.mDeterministic	= GetConfigValue("Sync","Deterministic",0) != 0;
+	return params;
+}
+/*!
+ @return 
+
+ Reads the tuning and worker count from the physics config file.
+*//*__________________________________________________________________________*/
+Physics::Engine::Engine(void): mIsStatic(false),mWasStatic(true),mAccumulator(k0),mRenderAlpha(k0),
+	mStepHash(0),mStepCount(0)
+{
+	mAuxEngine = new AuxEngine();
+	SetParams(ConfigParams());
+	SetWorkerCount(GetConfigValue("Threads","Workers",1u));
+}
+/*!
+ @param params	Tuning to simulate with; the config file is not read, and
+				the engine starts with one worker.
+*//*__________________________________________________________________________*/
+Physics::Engine::Engine(const Params &params): mIsStatic(false),mWasStatic(true),mAccumulator(k0),mRenderAlpha(k0),
+	mStepHash(0),mStepCount(0)
+{
+	mAuxEngine = new AuxEngine();
+	SetParams(params);
+}
+/*!
+ @param params	Tuning to simulate with from now on.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetParams(const Params &params)
+{
+	mParams = params;
+	SetSleepThresholds(params.mSleepLinVel, params.mSleepAngVel, params.mSleepTime);
+	SetStepRate(params.mStepRate, params.mStepSubsteps, params.mMaxSteps);
+	SetEventSolver(params.mEventSolver, params.mMaxEvents);
+	SetContactSolver(params.mSolverIterations, params.mWarmStart);
+	SetDeterministic(params.mDeterministic);
+}
+/*!
+ @return 
+*//*__________________________________________________________________________*/
+Physics::Engine::~Engine()
+{
+	delete mAuxEngine;
+	mAuxEngine = 0;
+}
+/*!
+ @param value 
+ @return 
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetGravity(Vector3D value)
+{
+	mParams.mGravity = value;
+}
+/*!
+ @param count	Threads the simulation may use, counting the caller; 0 means
+				one per core. Results are the same for any count.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetWorkerCount(unsigned count)
+{
+	mAuxEngine->mJobs.Workers(count);
+}
+/*!
+ @return Threads the simulation uses, counting the caller.
+*//*__________________________________________________________________________*/
+unsigned Physics::Engine::GetWorkerCount(void) const
+{
+	return mAuxEngine->mJobs.Workers();
+}
+/*!
+ @param linearVel	Speed below which a body counts as still.
+ @param angularVel	Spin below which a body counts as still.
+ @param time		Seconds a whole island must stay still before it sleeps;
+					0 turns sleeping off.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetSleepThresholds(Real linearVel, Real angularVel, Real time)
+{
+	mParams.mSleepLinVel	= linearVel;
+	mParams.mSleepAngVel	= angularVel;
+	mParams.mSleepTime		= time;
+	if(time <= k0)
+		WakeAll();
+}
+/*!
+ @param void
+*//*__________________________________________________________________________*/
+void Physics::Engine::WakeAll(void)
+{
+	BodyStore &bodies = mAuxEngine->mBodies;
+	for(uint32_t i = 0; i < bodies.Count(); ++i)
+		Wake(bodies.Body(i));
+}
+/*!
+ @param body	A body something outside the simulation just changed.
+
+ Wakes the body and its island, and restarts its count towards sleep.
+*//*__________________________________________________________________________*/
+void Physics::Engine::Wake(RigidBody* body)
+{
+	BodyStore &bodies = mAuxEngine->mBodies;
+	bodies.Wake(body->Index());
+	bodies.mQuietTime[body->Index()] = k0;
+}
+/*!
+ @param hz			Fixed steps per second.
+ @param substeps	Update() steps within each fixed step.
+ @param maxSteps	Most fixed steps a single Advance() takes; time beyond
+					that is dropped so a slow frame cannot snowball.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetStepRate(Real hz, int substeps, int maxSteps)
+{
+	mParams.mStepRate		= hz > k0 ? hz : Physics::kDef_StepRate;
+	mParams.mStepSubsteps	= substeps > 0 ? substeps : 1;
+	mParams.mMaxSteps		= maxSteps > 0 ? maxSteps : 1;
+	mAccumulator	= k0;
+}
+/*!
+ @param elapsed	Real seconds since the last call.
+ @return How far the render state is between the last two steps, 0 to 1.
+
+ Runs as many fixed steps as the time owed allows, so the simulation keeps
+ wall-clock pace whatever the frame rate. propRenderPosition and
+ propRenderOrientation blend by the returned fraction.
+*//*__________________________________________________________________________*/
+Real Physics::Engine::Advance(Real elapsed)
+{
+	const Real step = k1 / mParams.mStepRate;
+	if(elapsed > k0)
+		mAccumulator += elapsed;
+
+	for(int i = 0; i < mParams.mMaxSteps && mAccumulator >= step; ++i)
+	{
+		mAuxEngine->mBodies.SaveRenderState();
+		Update(step, mParams.mStepSubsteps);
+		mAccumulator -= step;
+	}
+	// too far behind to catch up; let the simulation slow down instead
+	if(mAccumulator >= step)
+		mAccumulator = step * (Real)std::fmod(mAccumulator / step, k1);
+
+	mRenderAlpha = mAccumulator / step;
+	return mRenderAlpha;
+}
+/*!
+ @param on			Handle each step's contacts in time order, moving the
+					bodies to every impact and re-testing what it changed,
+					instead of resolving them all against the end of the step.
+ @param maxEvents	Most contacts re-tested in one step; past that the rest
+					of the step's contacts are resolved as found.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetEventSolver(bool on, int maxEvents)
+{
+	mParams.mEventSolver	= on;
+	mParams.mMaxEvents		= maxEvents > 0 ? maxEvents : 1;
+	mAuxEngine->mBroadphase.mSwept = on;
+}
+/*!
+ @param iterations	Passes the ContactSolver makes over each step's contacts;
+					0 goes back to resolving each contact once, in order.
+ @param warmStart	Start each step from the impulses the same pairs ended
+					the last step with.
+
+ Solving the contacts together lets a longer step (SetMinTimeStep()) still
+ pass the break along the rack properly. Not used by the event solver.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetContactSolver(int iterations, bool warmStart)
+{
+	mParams.mSolverIterations	= iterations > 0 ? iterations : 0;
+	mParams.mWarmStart			= warmStart;
+	mAuxEngine->mSolver.Clear();
+}
+/*!
+ @param on	Record StateHash() after every step, for peers that compare
+			their worlds by checksum.
+
+ The simulation itself always runs the same way for the same input: bodies,
+ springs and contacts go in a fixed order, the float mode is pinned (see
+ FloatMode) and the worker count does not matter. What peers must also share
+ is the sequence of steps, so drive the engine from Advance(), not from a
+ frame-time Update().
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetDeterministic(bool on)
+{
+	mParams.mDeterministic	= on;
+	mStepHash		= on ? StateHash() : 0;
+	mStepCount		= 0;
+}
+/*!
+ @return A checksum of every body's state right now; equal on two engines
+		 only if their worlds match bit for bit.
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::StateHash(void) const
+{
+	return mAuxEngine->mBodies.StateHash();
+}
+/*!
+ @param *cb 
+*//*__________________________________________________________________________*/
+void Physics::Engine::AddPhysicsCallback(int type, PhysicsCB callbackFn)
+{
+	if(callbackFn)
+		mAuxEngine->mCallbacks[type] = callbackFn;
+}
+/*!
+ @param radius 
+ @return 
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddRigidBodySphere(Real radius)
+{
+	uint32_t id					= mAuxEngine->mBodies.Create();
+	RigidBody* body				= mAuxEngine->mBodies.Lookup(id);
+	GeometryType* collide		= 0;
+	collide		= new Sphere(radius);
+
+	body->InertiaKind(kI_Sphere);
+	body->SetCollisionObject(collide);
+	body->AngVelocityDamp(200.0);
+	return id;
+}
+/*!
+ @param plane 
+ @return 
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddRigidBodyPlane(Geometry::Plane3D& plane)
+{
+	uint32_t id					= mAuxEngine->mBodies.Create();
+	RigidBody* body				= mAuxEngine->mBodies.Lookup(id);
+	GeometryType* collide		= 0;
+	collide		= new Plane(plane);
+
+	body->InertiaKind(kI_Immobile);
+	body->SetCollisionObject(collide);
+	body->Spinnable(false);
+	body->Translatable(false);
+
+	return id;
+}
+/*!
+ @param p0 A point on the plane.
+ @param p1 A point on the plane.
+ @param p2 A point on the plane.
+ @return A unique id in the physics simulation.
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddRigidBodyBoundedPlane(const Physics::BoundedPlane& p)
+{
+	uint32_t id					= mAuxEngine->mBodies.Create();
+	RigidBody* body				= mAuxEngine->mBodies.Lookup(id);
+	GeometryType* collide		= 0;
+
+	collide		= new BoundedPlane(p);
+
+	body->InertiaKind(kI_Immobile);
+	body->SetCollisionObject(collide);
+	body->Spinnable(false);
+	body->Translatable(false);
+
+	return id;
+}
+/*!
+ @param geom	A new collision shape; the body takes ownership.
+ @return A unique id in the physics simulation.
+
+ Capsules, boxes and hulls start out fixed in place, like planes. Make one
+ translatable and move it by hand (the cue, say) and spheres it strikes
+ take its velocity into account.
+*//*__________________________________________________________________________*/
+static uint32_t AddFixedShape(Physics::AuxEngine* aux, Physics::GeometryType* geom)
+{
+	uint32_t id					= aux->mBodies.Create();
+	Physics::RigidBody* body	= aux->mBodies.Lookup(id);
+
+	body->InertiaKind(Physics::kI_Immobile);
+	body->SetCollisionObject(geom);
+	body->Spinnable(false);
+	body->Translatable(false);
+
+	return id;
+}
+/*!
+ @param halfLength	Half the length of the capsule's segment, along local Z.
+ @param radius 
+ @return A unique id in the physics simulation.
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddRigidBodyCapsule(Real halfLength, Real radius)
+{
+	return AddFixedShape(mAuxEngine, new Capsule(halfLength, radius));
+}
+/*!
+ @param halfExtents 
+ @return A unique id in the physics simulation.
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddRigidBodyBox(const Vector3D &halfExtents)
+{
+	return AddFixedShape(mAuxEngine, new Box(halfExtents));
+}
+/*!
+ @return False if the faces leave the hull open or hold no point; the
+		 bounding radius is then 0.
+
+ Sets the bounding radius to the distance of the furthest corner, where
+ three faces meet inside the others. The hull is open if some direction
+ leads away from every face: such a direction lies along the line two
+ faces share, or along any line if every face is parallel.
+*//*__________________________________________________________________________*/
+bool Physics::ConvexHull::FitBound(void)
+{
+	const Real slack = 1.0e-4f;
+	const size_t faces = mNormals.size();
+	mBound = k0;
+
+	bool crossed = false;
+	for(size_t i = 0; i < faces; ++i)
+	{
+		for(size_t j = i + 1; j < faces; ++j)
+		{
+			Vector3D line = mNormals[i] ^ mNormals[j];
+			if((Real)line.length() <= kEpsilon)
+				continue;
+			crossed = true;
+			line = line.normal();
+			bool up = true, down = true;
+			for(size_t k = 0; k < faces && (up || down); ++k)
+			{
+				Real d = (Real)(mNormals[k] * line);
+				up		= up && d <= slack;
+				down	= down && -d <= slack;
+			}
+			if(up || down)
+				return false;
+		}
+	}
+	if(!crossed)
+		return false;
+
+	for(size_t i = 0; i < faces; ++i)
+	{
+		for(size_t j = i + 1; j < faces; ++j)
+		{
+			Vector3D jk, ki, ij = mNormals[i] ^ mNormals[j];
+			for(size_t k = j + 1; k < faces; ++k)
+			{
+				Real det = (Real)(mNormals[k] * ij);
+				if(Math::Abs(det) <= kEpsilon)
+					continue;
+				jk = mNormals[j] ^ mNormals[k];
+				ki = mNormals[k] ^ mNormals[i];
+				Vector3D corner = (mOffsets[i] * jk + mOffsets[j] * ki + mOffsets[k] * ij) * (k1 / det);
+				bool inside = true;
+				for(size_t f = 0; f < faces && inside; ++f)
+					inside = (Real)(mNormals[f] * corner) - mOffsets[f] <= slack * (k1 + Math::Abs(mOffsets[f]));
+				if(inside)
+					mBound = std::max(mBound, (Real)corner.length());
+			}
+		}
+	}
+	return mBound > k0;
+}
+/*!
+ @param hull	Faces relative to the body's position; they must close the hull.
+ @return A unique id in the physics simulation, or BodyStore::kInvalid if
+		 the hull is open or empty (see ConvexHull::FitBound()).
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddRigidBodyConvexHull(const Physics::ConvexHull &hull)
+{
+	ConvexHull* shape = new ConvexHull(hull);
+	if(!shape->FitBound())
+	{
+		delete shape;
+		return BodyStore::kInvalid;
+	}
+	return AddFixedShape(mAuxEngine, shape);
+}
+/*!
+ @param id 
+ @return 
+*//*__________________________________________________________________________*/
+bool Physics::Engine::RemoveRigidBody(uint32_t id)
+{
+	bool ret = false;
+
+	if(mAuxEngine->mBodies.Lookup(id) != 0)
+	{
+		// remove any springs that may be attached to body being removed.
+		mAuxEngine->mSprings.DestroyAttached(id);
+		mAuxEngine->mBodies.Destroy(id);
+		ret = true;
+	}
+
+	return ret;
+}
+/*!
+ @param src	The engine to copy.
+
+ Makes this engine simulate the same world as src: bodies (under the same
+ ids), springs, gravity, time step, limits and the at-rest state. The
+ callbacks and worker count are this engine's own. Copying again from the
+ same engine, with no bodies added or removed in between, only copies state.
+*//*__________________________________________________________________________*/
+void Physics::Engine::CopyWorld(const Engine &src)
+{
+	if(&src == this)
+		return;
+	AuxEngine* from	= src.mAuxEngine;
+	AuxEngine* to	= mAuxEngine;
+
+	to->mBodies.CopyFrom(from->mBodies);
+
+	// springs name bodies by handle, and ours are the same handles
+	to->mSprings.CopyFrom(from->mSprings);
+
+	mIsStatic	= src.mIsStatic;
+	mWasStatic	= src.mWasStatic;
+	mParams		= src.mParams;
+	to->mBroadphase.mSwept = from->mBroadphase.mSwept;
+	to->mCollisionEngine.mPairTable = from->mCollisionEngine.mPairTable;
+	to->mSolver.CopyFrom(from->mSolver);
+	// the copied fixed bodies may sit elsewhere than ours did
+	to->mBroadphase.Invalidate();
+	mStepHash	= src.mStepHash;
+	mStepCount		= src.mStepCount;
+}
+/*!
+ @param snapshot	Receives the state; its buffer is reused.
+
+ Layout: a SnapshotHeader, the body state arrays (see BodyStore::SaveState),
+ then one SpringRecord per spring in dense order; mId is the spring's handle.
+*//*__________________________________________________________________________*/
+void Physics::Engine::SaveSnapshot(WorldSnapshot &snapshot) const
+{
+	const BodyStore &bodies = mAuxEngine->mBodies;
+	const SpringStore &springs = mAuxEngine->mSprings;
+	snapshot.mData.resize(sizeof(SnapshotHeader) + bodies.StateBytes() + springs.Count() * sizeof(SpringRecord));
+	uint8_t* out = snapshot.mData.data();
+
+	SnapshotHeader header = {};
+	header.mMagic		= kSnapshotMagic;
+	header.mVersion		= kSnapshotVersion;
+	header.mSpringCount	= springs.Count();
+	header.mIsStatic	= mIsStatic;
+	header.mWasStatic	= mWasStatic;
+	std::memcpy(out, &header, sizeof(header));
+	out += sizeof(header);
+
+	out = bodies.SaveState(out);
+
+	for(uint32_t i = 0; i < springs.Count(); ++i)
+	{
+		// cleared whole so the padding around the Vector3Ds is the same every time
+		SpringRecord record;
+		std::memset(static_cast< void* >(&record), 0, sizeof(record));
+		record.mId				= springs.Handle(i);
+		record.mBody1			= springs.mBody1[i];
+		record.mBody2			= springs.mBody2[i];
+		record.mStiffness		= springs.mStiffness[i];
+		record.mDamping			= springs.mDamping[i];
+		record.mRestLength		= springs.mRestLength[i];
+		record.mPrevLength		= springs.mPrevLength[i];
+		record.mPos1			= springs.mPos1[i];
+		record.mPos2			= springs.mPos2[i];
+		record.mCompressible	= springs.Flag(i, SpringStore::kF_Compressible);
+		record.mCenterAttach1	= springs.Flag(i, SpringStore::kF_CenterAttach1);
+		record.mCenterAttach2	= springs.Flag(i, SpringStore::kF_CenterAttach2);
+		std::memcpy(out, &record, sizeof(record));
+		out += sizeof(record);
+	}
+}
+/*!
+ @param snapshot	State from SaveSnapshot().
+ @return False, with nothing changed, if the snapshot is damaged or was
+		 taken of a different set of bodies.
+*//*__________________________________________________________________________*/
+bool Physics::Engine::RestoreSnapshot(const WorldSnapshot &snapshot)
+{
+	const std::vector< uint8_t > &data = snapshot.mData;
+	SnapshotHeader header;
+	if(data.size() < sizeof(header))
+		return false;
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	BodyStore &bodies = mAuxEngine->mBodies;
+	if(header.mMagic != kSnapshotMagic || header.mVersion != kSnapshotVersion
+		|| data.size() != sizeof(header) + bodies.StateBytes() + header.mSpringCount * sizeof(SpringRecord))
+		return false;
+
+	const uint8_t* in = bodies.LoadState(data.data() + sizeof(header));
+	if(!in)
+		return false;
+	bodies.SaveRenderState();
+	if(mParams.mDeterministic)
+		mStepHash = bodies.StateHash();
+
+	// springs are plain data, so they are rebuilt if the set changed
+	SpringStore &springs = mAuxEngine->mSprings;
+	std::vector< SpringRecord > records(header.mSpringCount);
+	std::vector< uint32_t > handles(records.size());
+	if(!records.empty())
+		std::memcpy(&records[0], in, records.size() * sizeof(SpringRecord));
+	for(size_t r = 0; r < records.size(); ++r)
+		handles[r] = records[r].mId;
+	springs.Rebuild(handles);
+	for(uint32_t i = 0; i < springs.Count(); ++i)
+	{
+		const SpringRecord &record = records[i];
+		springs.SetBodies(i, record.mBody1, record.mBody2);
+		springs.mStiffness[i]	= record.mStiffness;
+		springs.mDamping[i]		= record.mDamping;
+		springs.mRestLength[i]	= record.mRestLength;
+		springs.mPrevLength[i]	= record.mPrevLength;
+		springs.mPos1[i]		= record.mPos1;
+		springs.mPos2[i]		= record.mPos2;
+		springs.Flag(i, SpringStore::kF_Compressible, record.mCompressible != 0);
+		springs.Flag(i, SpringStore::kF_CenterAttach1, record.mCenterAttach1 != 0);
+		springs.Flag(i, SpringStore::kF_CenterAttach2, record.mCenterAttach2 != 0);
+	}
+
+	mAuxEngine->mBroadphase.Invalidate();
+	// the warm-start impulses are not part of the snapshot
+	mAuxEngine->mSolver.Clear();
+	mIsStatic	= header.mIsStatic != 0;
+	mWasStatic	= header.mWasStatic != 0;
+	return true;
+}
+/*!
+ @param void 
+*//*__________________________________________________________________________*/
+void Physics::Engine::RemoveAll(void)
+{
+	mAuxEngine->mBodies.Clear();
+	mAuxEngine->mSprings.Clear();
+}
+/*!
+ @param void 
+ @return 
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::AddSpring(void)
+{
+	return mAuxEngine->mSprings.Create();
+}
+/*!
+ @param uint32_t 
+ @return 
+*//*__________________________________________________________________________*/
+bool Physics::Engine::RemoveSpring(uint32_t id)
+{
+	return mAuxEngine->mSprings.Destroy(id);
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::RigidBodyBool(uint32_t id, eRigidBodyBool prop, bool value)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		if(prop == propSleeping)
+		{
+			if(!value)
+				Wake(body);
+			else if(!body->Sleeping())
+				mAuxEngine->mBodies.Sleep(body->Index(), id);
+			return;
+		}
+		Wake(body);
+		switch(prop)
+		{
+		case propActive:
+			body->Active(value);		break;
+		case propUseGravity:
+			body->Gravity(value);		break;
+		case propCollidable:
+			body->Collidable(value);	break;
+		case propSpinnable:
+			body->Spinnable(value);		break;
+		case propTranslatable:
+			body->Translatable(value);
+			// fixed shapes live in the broadphase's tree; this one may join or leave it
+			mAuxEngine->mBroadphase.Invalidate();	break;
+		case propSleeping:
+			// set above, without waking the body first
+			break;
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+bool Physics::Engine::RigidBodyBool(uint32_t id, eRigidBodyBool prop)
+{
+	bool ret = false;
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		switch(prop)
+		{
+		case propActive:
+			ret = body->Active();		break;
+		case propUseGravity:
+			ret = body->Gravity();		break;
+		case propCollidable:
+			ret = body->Collidable();	break;
+		case propSpinnable:
+			ret = body->Spinnable();	break;
+		case propTranslatable:
+			ret = body->Translatable();	break;
+		case propSleeping:
+			ret = body->Sleeping();		break;
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::RigidBodyScalar(uint32_t id, eRigidBodyScalar prop, Real value)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		Wake(body);
+		switch(prop)
+		{
+		case propAngVelDamp:
+			body->AngVelocityDamp(value);		break;
+		case propLinVelDamp:
+			body->LinVelocityDamp(value);		break;
+		case propMass:
+			body->Mass(value);					break; 
+			// mass must be greater than .2 for accuracy
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+Real Physics::Engine::RigidBodyScalar(uint32_t id, eRigidBodyScalar prop)
+{
+	Real ret = k0;
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		switch(prop)
+		{
+		case propAngVelDamp:
+			ret = body->AngVelocityDamp();		break;
+		case propLinVelDamp:
+			ret = body->LinVelocityDamp();		break;
+		case propMass:
+			ret = body->Mass();					break; 
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::RigidBodyVector3D(uint32_t id, eRigidBodyVector prop, Vector3D value)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		Wake(body);
+		switch(prop)
+		{
+		case propDimensions:
+			body->mExtent = value;				break;
+		case propPosition:
+			// moved by hand, so drawn there straight away
+			body->PositionT1() = value;
+			mAuxEngine->mBodies.mRenderPosition[body->Index()] = value;
+			if(!body->Translatable())
+				mAuxEngine->mBroadphase.Invalidate();
+			break;
+		case propVeloctity:
+			body->VelocityT1() = value;
+			if(!body->Translatable())
+				mAuxEngine->mBroadphase.Invalidate();
+			break;
+		case propRenderPosition:
+			mAuxEngine->mBodies.mRenderPosition[body->Index()] = value;	break;
+		case propAngVelocity:
+			body->AngularVelocityT1() = value;	break;
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+Vector3D Physics::Engine::RigidBodyVector3D(uint32_t id, eRigidBodyVector prop)
+{
+	Vector3D ret = vZero;
+	
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		switch(prop)
+		{
+		case propDimensions:
+			ret = body->mExtent;				break;
+		case propPosition:
+			ret = body->PositionT1();		break;
+		case propVeloctity:
+			ret = body->VelocityT1() ;	break;
+		case propRenderPosition:
+			ret = mAuxEngine->mBodies.RenderPosition(body->Index(), mRenderAlpha);	break;
+		case propAngVelocity:
+			ret = body->AngularVelocityT1();	break;
+		}
+	}
+
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::RigidBodyQuaternion(uint32_t id, eRigidBodyQuaternion prop, Quaternion value)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		Wake(body);
+		switch(prop)
+		{
+		case propOrientation:
+			body->OrientationT1() = value;
+			mAuxEngine->mBodies.mRenderOrientation[body->Index()] = value;	break;
+		case propRenderOrientation:
+			mAuxEngine->mBodies.mRenderOrientation[body->Index()] = value;	break;
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+Quaternion Physics::Engine::RigidBodyQuaternion(uint32_t id, eRigidBodyQuaternion prop)
+{
+	Quaternion ret = qZero;
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		switch(prop)
+		{
+		case propOrientation:
+			ret = body->OrientationT1();	break;
+		case propRenderOrientation:
+			ret = mAuxEngine->mBodies.RenderOrientation(body->Index(), mRenderAlpha);	break;
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @return 
+*//*__________________________________________________________________________*/
+Matrix4x4 Physics::Engine::RigidBodyTransformationMatrix(uint32_t id)
+{
+	Matrix4x4 ret;
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		if(body->Spinnable())
+		{
+			ret = body->OrientationT1().Basis();
+		}
+		else
+		{
+			ret.reset();
+		}
+		ret[0][3] = body->PositionT1()[0];
+		ret[1][3] = body->PositionT1()[1];
+		ret[2][3] = body->PositionT1()[2];
+		
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::SpringBool(uint32_t id, eSpringBool prop, bool value)
+{
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propSpringCompressible:
+			springs.Flag(index, SpringStore::kF_Compressible, value);
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+bool Physics::Engine::SpringBool(uint32_t id, eSpringBool prop)
+{
+	bool ret = false;
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propSpringCompressible:
+			ret = springs.Flag(index, SpringStore::kF_Compressible);	break;
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::SpringBody(uint32_t id, eSpringID prop, uint32_t value)
+{
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propBody1:
+			if(mAuxEngine->mBodies.Lookup(value) != 0)
+			{
+				springs.SetBodies(index, value, springs.mBody2[index]);
+			}
+			else
+			{
+				char buf[100] = {0};
+				sprintf(buf, "Can't attach spring to nonexistant body. Spring: %d, Body: %d", id, value); 
+			}
+			break;
+		case propBody2:
+			if(mAuxEngine->mBodies.Lookup(value) != 0)
+			{
+				springs.SetBodies(index, springs.mBody1[index], value);
+			}
+			else
+			{
+				char buf[100] = {0};
+				sprintf(buf, "Can't attach spring to nonexistant body. Spring: %d, Body: %d", id, value); 
+			}
+			break;
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+uint32_t Physics::Engine::SpringBody(uint32_t id, eSpringID prop)
+{
+	uint32_t ret = 0;
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propBody1:
+			ret = springs.mBody1[index]; break;
+		case propBody2:
+			ret = springs.mBody2[index]; break;
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::SpringScalar(uint32_t id, eSpringScalar prop, Real value)
+{
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propSpringStiffness:
+			springs.mStiffness[index] = value;		break;
+		case propSpringRestLength:
+			springs.mRestLength[index] = value;
+			springs.mPrevLength[index] = value;	break;
+		case propSpringDamping:
+			springs.mDamping[index] = value;
+			if(value > k1 || value < k0)
+			{
+				char buf[100] = {0};
+				sprintf(buf, "Illegal damping value: %f.  0 for no damping, 1 for critical damping.", value);
+			}
+			break;
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+Real Physics::Engine::SpringScalar(uint32_t id, eSpringScalar prop)
+{
+	Real ret = k0;
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propSpringStiffness:
+			ret = springs.mStiffness[index];		break;
+		case propSpringRestLength:
+			ret = springs.mRestLength[index];		break;
+		case propSpringDamping:
+			ret = springs.mDamping[index];			break;
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param prop 
+ @param value 
+*//*__________________________________________________________________________*/
+void Physics::Engine::SpringVector(uint32_t id, eSpringVector prop, Vector3D value)
+{
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propAttachPoint1:
+			springs.mPos1[index] = value;
+			springs.Flag(index, SpringStore::kF_CenterAttach1, (value * value) <= kEpsilon); // true if zero vector
+			break;
+		case propAttachPoint2:
+			springs.mPos2[index] = value;
+			springs.Flag(index, SpringStore::kF_CenterAttach2, (value * value) <= kEpsilon); // true if zero vector
+			break;
+		}
+	}
+}
+/*!
+ @param id 
+ @param prop 
+ @return 
+*//*__________________________________________________________________________*/
+Vector3D Physics::Engine::SpringVector(uint32_t id, eSpringVector prop)
+{
+	Vector3D ret = vZero;
+	SpringStore &springs = mAuxEngine->mSprings;
+	uint32_t index = springs.Find(id);
+	if(index != SpringStore::kNoIndex)
+	{
+		switch(prop)
+		{
+		case propAttachPoint1:
+			ret = springs.mPos1[index];	break;
+		case propAttachPoint2:
+			ret = springs.mPos2[index];	break;
+		}
+	}
+	return ret;
+}
+/*!
+ @param id 
+ @param force 
+*//*__________________________________________________________________________*/
+void Physics::Engine::AddImpulse(uint32_t id, Vector3D force)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		Wake(body);
+		if(body->Translatable())
+			body->AddForce(force);
+	}
+}
+/*!
+ @param id 
+ @param torque 
+*//*__________________________________________________________________________*/
+void Physics::Engine::AddTwist(uint32_t id, Vector3D torque)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		Wake(body);
+		if(body->Spinnable())
+			body->AddTorque(torque);
+	}
+}
+/*!
+ @param id 
+*//*__________________________________________________________________________*/
+void Physics::Engine::StopMoving(uint32_t id)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		if(body->Translatable())
+		{
+			body->Force() = vZero;
+			body->VelocityT0() = vZero;
+			body->VelocityT1() = vZero;
+		}
+	}
+}
+/*!
+ @param id 
+*//*__________________________________________________________________________*/
+void Physics::Engine::StopSpinning(uint32_t id)
+{
+	RigidBody* body = mAuxEngine->mBodies.Lookup(id);
+	if(body)
+	{
+		//if(body->Spinnable())
+		{
+			body->Torque() = vZero;
+			body->AngularVelocityT0() = vZero;
+			body->AngularVelocityT1() = vZero;
+			body->AngularMomentumT0() = vZero;
+			body->AngularMomentumT1() = vZero;
+		}
+	}
+}
+/*!
+ @param dt 
+*//*__________________________________________________________________________*/
+void Physics::Engine::SetMinTimeStep(Real dt)
+{
+	mParams.mMinTimeStep = dt;
+}
+/*!
+ @param dt 
+*//*__________________________________________________________________________*/
+void Physics::Engine::Update(Real dt, int steps)
+{
+//ProfileFn;
+   // LogS->Post(__FUNCTION__);
+   // static int call_count = 0;
+    if(AtRest())
+            return;
+    
+	FloatMode mode;
+	if(mWasStatic)
+		mStepCount = 0;
+    mIsStatic = true;
+    //steps *= 3;
+		// fluid drag constant
+		//const Real b = 50.0;
+		//volatile int staticLinearCount = 0;
+		//volatile int staticAngularCount = 0;
+		volatile int activeCount = 0;
+		//volatile int SpinnableCount = 0;
+
+        // apply drag to every free sphere in the simulation (the balls, in the game)
+		BodyStore &bodies = mAuxEngine->mBodies;
+		for(uint32_t i = 0; i < bodies.Count(); ++i)
+		{
+            RigidBody* body = bodies.Body(i);
+            if(!body->Translatable() || body->mCollideGeom == 0 || body->mCollideGeom->Kind() != kC_Sphere)
+                continue;
+            // asleep means stopped
+            if(body->Sleeping())
+                continue;
+            
+            Vector3D v = body->VelocityT1();
+            if(v.length() > .2)
+            {
+                body->AddForce((-mParams.mDragCoeff/steps) * v);
+				++activeCount;
+                mIsStatic = false;
+            }
+            else if(v.length() > kEpsilon)
+			{
+					StopMoving(bodies.Handle(i));
+            }
+        }
+		
+
+		if(activeCount)
+		{
+            for(int i = 0; i < steps; ++i)
+	    	{
+			    Simulate(dt/steps);
+
+    		}
+			++mStepCount;
+	    }
+		// before the callback, which may move things for the next turn
+		if(mParams.mDeterministic)
+			mStepHash = StateHash();
+        if(!activeCount && !mWasStatic && mAuxEngine->mCallbacks.count(kCallbackGoneStatic) != 0 && mAuxEngine->mCallbacks[kCallbackGoneStatic] != 0)
+        {
+           mAuxEngine->mCallbacks[kCallbackGoneStatic](0,0,0);
+        }	
+		
+		
+		mWasStatic = mIsStatic;
+}
+/*!
+ @param void 
+ @return 
+*//*__________________________________________________________________________*/
+bool Physics::Engine::AtRest(void)const { return mIsStatic; }
+void Physics::Engine::AtRest(bool b) { mIsStatic = b; }
+/*!
+ @param void 
+*//*__________________________________________________________________________*/
+void Physics::Engine::StopAll(void)
+{
+	BodyStore &bodies = mAuxEngine->mBodies;
+	for(uint32_t i = 0; i < bodies.Count(); ++i)
+	{
+		StopMoving(bodies.Handle(i));
+		StopSpinning(bodies.Handle(i));
+	}
+}
+uint32_t	Physics::Engine::Kind(uint32_t id)const
+{
+	return mAuxEngine->mBodies.Lookup(id)->mCollideGeom->Kind();
+}
+/*!
+ @param dt 
+*//*__________________________________________________________________________*/
+void Physics::Engine::Simulate(Real dt)
+{	ProfileFn;
+	FloatMode mode;
+	//LogS->Post(__FUNCTION__);
+	int steps;
+	if(dt > mParams.mMinTimeStep)
+	{
+		steps = 1 + (int)(dt / mParams.mMinTimeStep);
+		dt /= (float)steps;
+	}
+	else
+	{
+		steps = 1;
+	}
+
+	BodyStore &bodies = mAuxEngine->mBodies;
+	JobPool &jobs = mAuxEngine->mJobs;
+	Collision::Engine &collide = mAuxEngine->mCollisionEngine;
+	const Params &params = mParams;
+
+	// bodies are independent until the springs and collisions couple them
+	JobPool::RangeFn integrate1 = [&bodies, dt](uint32_t begin, uint32_t end)
+	{
+		// reset for current timestep
+		bodies.ResetForNextTimeStep(begin, end);
+		bodies.Integrate1(dt, begin, end);
+	};
+	JobPool::RangeFn integrate2 = [&bodies, dt, &params](uint32_t begin, uint32_t end)
+	{
+		bodies.Integrate2(dt, params, begin, end);
+	};
+	// each pair tests on its own; contacts are put back in pair order by Collect()
+	std::vector< Collision::Pair > &pairs = mAuxEngine->mBroadphase.mPairs;
+	JobPool::RangeFn narrowphase = [&bodies, &pairs, &collide](uint32_t begin, uint32_t end)
+	{
+		// sphere pairs go through the batched test, everything else one at a time
+		Collision::SphereSweepBatch batch;
+		uint32_t order[Collision::SphereSweepBatch::kCapacity];
+		for(uint32_t p = begin; p < end; ++p)
+		{
+			RigidBody* body1 = bodies.Body(pairs[p].mBody1);
+			RigidBody* body2 = bodies.Body(pairs[p].mBody2);
+			if(body1->mCollideGeom->Kind() != kC_Sphere || body2->mCollideGeom->Kind() != kC_Sphere)
+			{
+				collide.TestCollision(body1, body2, p);
+				continue;
+			}
+			order[batch.Push(body1->PositionT0(), body1->PositionT1(), ((Sphere*)body1->mCollideGeom)->mRadius,
+							body2->PositionT0(), body2->PositionT1(), ((Sphere*)body2->mCollideGeom)->mRadius)] = p;
+			if(batch.Full())
+				RunSphereBatch(collide, bodies, pairs, batch, order);
+		}
+		RunSphereBatch(collide, bodies, pairs, batch, order);
+	};
+	JobPool::RangeFn impacts = [&bodies, &pairs, &collide](uint32_t begin, uint32_t end)
+	{
+		for(uint32_t p = begin; p < end; ++p)
+			collide.TestImpact(bodies.Body(pairs[p].mBody1), bodies.Body(pairs[p].mBody2), p);
+	};
+
+	for(int i = 0; i < steps; ++i)
+	{
+		// loop over all objects
+		jobs.ParallelFor(bodies.Count(), kIntegrateGrain, integrate1);
+
+		// all springs at once, then their forces onto the bodies
+		mAuxEngine->mSprings.ApplyForces(bodies);
+		// loop over all objects again after spring forces
+		jobs.ParallelFor(bodies.Count(), kIntegrateGrain, integrate2);
+
+		// loop over all objects, detect and resolve collisions
+		collide.Begin();
+
+		// candidate pairs, in body order
+		mAuxEngine->mBroadphase.Update(bodies, dt);
+		jobs.ParallelFor((uint32_t)pairs.size(), kNarrowphaseGrain, mParams.mEventSolver ? impacts : narrowphase);
+
+		// back on this thread: fixed order, then the game callbacks
+        collide.Collect();
+		if(mParams.mEventSolver)
+		{
+			ResolveEvents(dt);
+		}
+		else if(mParams.mSolverIterations > 0)
+		{
+			collide.Dispatch();
+			std::sort(collide.mContacts.begin(), collide.mContacts.end(), EventLess());
+			mAuxEngine->mSolver.Solve(collide, bodies, dt, mParams);
+		}
+		else
+		{
+			collide.Dispatch();
+			std::sort(collide.mContacts.begin(), collide.mContacts.end(), EventLess());
+
+			// resolve the collisions for this iteration
+			std::vector< Collision::Contact* >::iterator cIt;
+			for(cIt = collide.mContacts.begin(); cIt != collide.mContacts.end(); ++cIt)
+				collide.Resolve(*cIt);
+		}
+    	
+		// wake what the contacts reached, then let still islands sleep
+		UpdateSleep(dt);
+
+		// clean up collision free list
+		collide.End();
+       
+      
+	}
+
+
+
+
+}
+/*!
+ @param contact	A contact found by TestImpact().
+ @return True if its bodies are moving into each other along the normal.
+*//*__________________________________________________________________________*/
+static bool Closing(const Collision::Contact* contact)
+{
+	// plane contacts face the sphere whichever body comes first
+	Vector3D v = contact->mBody1->VelocityT1() - contact->mBody2->VelocityT1();
+	if(contact->mBody1->mCollideGeom->Kind() != Physics::kC_Sphere)
+		v = -v;
+	return v * contact->mNormal < k0;
+}
+/*!
+ @param dt	Length of the step.
+
+ The event solver. Takes the step's contacts earliest first. For each one,
+ every body is carried to the moment of impact and the contact is
+ dispatched and resolved; its two bodies then follow their new velocities
+ for the rest of the step, so whatever they were going to hit is forgotten
+ and they are tested again against every collidable body. Contact times
+ stay fractions of the whole step. After mParams.mMaxEvents re-tests, what is left
+ is resolved without looking further.
+
+ mContacts ends up holding the contacts handled, in the order handled.
+*//*__________________________________________________________________________*/
+void Physics::Engine::ResolveEvents(Real dt)
+{
+	BodyStore &bodies = mAuxEngine->mBodies;
+	Collision::Engine &collide = mAuxEngine->mCollisionEngine;
+	std::vector< Collision::Contact* > &pending = mAuxEngine->mEvents;
+	pending.assign(collide.mContacts.begin(), collide.mContacts.end());
+	collide.mContacts.clear();
+
+	const uint32_t count = bodies.Count();
+	uint32_t order = (uint32_t)mAuxEngine->mBroadphase.mPairs.size();
+	Real now = k0;		// every body has been carried this far into the step
+	int events = 0;
+	while(!pending.empty())
+	{
+		std::vector< Collision::Contact* >::iterator first = std::min_element(pending.begin(), pending.end(), EventLess());
+		Collision::Contact* contact = *first;
+		pending.erase(first);
+
+		if(contact->mTime > now)
+		{
+			Real f = (contact->mTime - now) / (k1 - now);
+			for(uint32_t i = 0; i < count; ++i)
+				bodies.mPositionT0[i] += f * (bodies.mPositionT1[i] - bodies.mPositionT0[i]);
+			now = contact->mTime;
+		}
+		collide.Dispatch(contact);
+		collide.Resolve(contact);
+		collide.mContacts.push_back(contact);
+
+		RigidBody* touched[2] = { contact->mBody1, contact->mBody2 };
+		for(int t = 0; t < 2; ++t)
+		{
+			RigidBody* body = touched[t];
+			if(body->Translatable())
+				body->PositionT1() = body->PositionT0() + ((k1 - now) * dt) * body->VelocityT1();
+		}
+		if(++events > mParams.mMaxEvents)
+			continue;
+
+		pending.erase(std::remove_if(pending.begin(), pending.end(), EventTouches(touched[0], touched[1])), pending.end());
+
+		for(int t = 0; t < 2; ++t)
+		{
+			RigidBody* body = touched[t];
+			if(!body->Collidable())
+				continue;
+			bool sphere = body->mCollideGeom->Kind() == kC_Sphere;
+			for(uint32_t i = 0; i < count; ++i)
+			{
+				RigidBody* other = bodies.Body(i);
+				// the pair itself is tested once, from its first body
+				if(other == touched[0] || other == body || !other->Collidable())
+					continue;
+				if(!sphere && other->mCollideGeom->Kind() != kC_Sphere)
+					continue;
+				uint32_t a = std::min(body->Index(), i), b = std::max(body->Index(), i);
+				Collision::Contact* found = collide.TestImpact(bodies.Body(a), bodies.Body(b), order++);
+				if(!found)
+					continue;
+				// already touching but parting; the arena takes it back at End()
+				if(!Closing(found))
+				{
+					found->mBody1 = found->mBody2 = 0;
+					continue;
+				}
+				found->mTime = now + found->mTime * (k1 - now);
+				pending.push_back(found);
+			}
+		}
+	}
+}
+/*!
+ @param parent	Union-find parents.
+ @param i		Dense index.
+ @return The lowest index in i's set.
+*//*__________________________________________________________________________*/
+static uint32_t IslandRoot(std::vector< uint32_t > &parent, uint32_t i)
+{
+	while(parent[i] != i)
+	{
+		parent[i] = parent[parent[i]];
+		i = parent[i];
+	}
+	return i;
+}
+static void JoinIslands(std::vector< uint32_t > &parent, uint32_t a, uint32_t b)
+{
+	a = IslandRoot(parent, a);
+	b = IslandRoot(parent, b);
+	if(a < b)
+		parent[b] = a;
+	else
+		parent[a] = b;
+}
+/*!
+ @param dt	Length of the step just taken.
+
+ Runs after the contacts are resolved. Anything a contact or a spring from an
+ awake body reached is woken with its island. Then the dynamic bodies are
+ grouped into islands through this step's contacts and the springs, and an
+ island sleeps once every body in it has been still for mParams.mSleepTime.
+*//*__________________________________________________________________________*/
+void Physics::Engine::UpdateSleep(Real dt)
+{
+	BodyStore &bodies = mAuxEngine->mBodies;
+	const std::vector< Collision::Contact* > &contacts = mAuxEngine->mCollisionEngine.mContacts;
+	SpringStore &springs = mAuxEngine->mSprings;
+	std::vector< uint32_t > &parent = mAuxEngine->mIslands;
+	const uint8_t kDynamic = BodyStore::kF_Translatable | BodyStore::kF_Spinnable;
+	const uint32_t count = bodies.Count();
+
+	std::vector< Collision::Contact* >::const_iterator cIt;
+	springs.Bind(bodies);
+
+	// the broadphase only pairs a sleeper with something moving
+	for(cIt = contacts.begin(); cIt != contacts.end(); ++cIt)
+	{
+		bodies.Wake((*cIt)->mBody1->Index());
+		bodies.Wake((*cIt)->mBody2->Index());
+	}
+	for(uint32_t s = 0; s < springs.Count(); ++s)
+	{
+		uint32_t i1 = springs.mIndex1[s];
+		uint32_t i2 = springs.mIndex2[s];
+		if(i1 == SpringStore::kNoIndex || i2 == SpringStore::kNoIndex)
+			continue;
+		if(bodies.Body(i1)->Sleeping() != bodies.Body(i2)->Sleeping())
+		{
+			bodies.Wake(i1);
+			bodies.Wake(i2);
+		}
+	}
+	if(mParams.mSleepTime <= k0)
+		return;
+
+	const Real linVel2 = mParams.mSleepLinVel * mParams.mSleepLinVel;
+	const Real angVel2 = mParams.mSleepAngVel * mParams.mSleepAngVel;
+	parent.resize(count);
+	for(uint32_t i = 0; i < count; ++i)
+	{
+		parent[i] = i;
+		uint8_t flags = bodies.mFlags[i];
+		if((flags & (BodyStore::kF_Active | BodyStore::kF_Sleeping)) != BodyStore::kF_Active || !(flags & kDynamic))
+			continue;
+		Vector3D &v = bodies.mVelocityT1[i];
+		Vector3D &w = bodies.mAngVelocityT1[i];
+		if(v * v < linVel2 && w * w < angVel2)
+			bodies.mQuietTime[i] += dt;
+		else
+			bodies.mQuietTime[i] = k0;
+	}
+
+	// only moving things hold an island together; walls and the table do not
+	for(cIt = contacts.begin(); cIt != contacts.end(); ++cIt)
+	{
+		RigidBody* body1 = (*cIt)->mBody1;
+		RigidBody* body2 = (*cIt)->mBody2;
+		if((bodies.mFlags[body1->Index()] & kDynamic) && (bodies.mFlags[body2->Index()] & kDynamic))
+			JoinIslands(parent, body1->Index(), body2->Index());
+	}
+	for(uint32_t s = 0; s < springs.Count(); ++s)
+	{
+		uint32_t i1 = springs.mIndex1[s];
+		uint32_t i2 = springs.mIndex2[s];
+		if(i1 == SpringStore::kNoIndex || i2 == SpringStore::kNoIndex)
+			continue;
+		if((bodies.mFlags[i1] & kDynamic) && (bodies.mFlags[i2] & kDynamic))
+			JoinIslands(parent, i1, i2);
+	}
+
+	// an island is ready when none of its awake members is still counting
+	std::vector< uint8_t > &ready = mAuxEngine->mIslandReady;
+	ready.assign(count, 1);
+	for(uint32_t i = 0; i < count; ++i)
+	{
+		uint8_t flags = bodies.mFlags[i];
+		if((flags & (BodyStore::kF_Active | BodyStore::kF_Sleeping)) != BodyStore::kF_Active || !(flags & kDynamic))
+			continue;
+		if(bodies.mQuietTime[i] < mParams.mSleepTime)
+			ready[IslandRoot(parent, i)] = 0;
+	}
+	for(uint32_t i = 0; i < count; ++i)
+	{
+		uint8_t flags = bodies.mFlags[i];
+		if((flags & (BodyStore::kF_Active | BodyStore::kF_Sleeping)) != BodyStore::kF_Active || !(flags & kDynamic))
+			continue;
+		uint32_t root = IslandRoot(parent, i);
+		if(ready[root])
+			bodies.Sleep(i, bodies.Handle(root));
+	}
+}
+
@@ -0,0 +1,195 @@
+/*!
+	@file	ShotBatch.cpp
+	@date	October 17, 2026
+
+	@brief	Simulates many candidate shots from one table state.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+
+#include "ShotBatch.h"
+#include "PhysicsAux.h"
+#include "RigidBody.h"
+
+namespace
+{
+	/// Shot being simulated on this thread; the engine callbacks carry no context.
+	struct ShotContext
+	{
+		uint32_t				mCueBall;
+		Physics::ShotOutcome*	mOutcome;
+	};
+	thread_local ShotContext* tShot = 0;
+
+	void OnPocket(Collision::Contact* c, Physics::RigidBody*, Physics::RigidBody*)
+	{
+		// the plane comes first; the same ball crosses a pocket for several steps
+		std::vector< uint32_t > &pocketed = tShot->mOutcome->mPocketed;
+		if(std::find(pocketed.begin(), pocketed.end(), c->mID2) == pocketed.end())
+		{
+			pocketed.push_back(c->mID2);
+			tShot->mOutcome->mPockets.push_back(c->mID1);
+		}
+	}
+
+	void OnSphere(Collision::Contact* c, Physics::RigidBody*, Physics::RigidBody*)
+	{
+		if(tShot->mOutcome->mFirstContact != 0)
+			return;
+		if(c->mID1 == tShot->mCueBall)
+			tShot->mOutcome->mFirstContact = c->mID2;
+		else if(c->mID2 == tShot->mCueBall)
+			tShot->mOutcome->mFirstContact = c->mID1;
+	}
+}
+
+namespace Physics
+{
+/*!
+ @param params	The tables' params; Start() takes each table's own.
+*//*__________________________________________________________________________*/
+ShotRunner::ShotRunner(const Params &params) : mEngine(params), mCueBall(0)
+{
+	mEngine.AddPhysicsCallback(kCollisionCBSpherePocket, OnPocket);
+	mEngine.AddPhysicsCallback(kCallbackRuleSS, OnSphere);
+}
+
+/*!
+ @param table	The table to shoot on. Only read here.
+ @param shot
+ @param outcome	Cleared, for Step() to fill in.
+*//*__________________________________________________________________________*/
+void ShotRunner::Start(const Engine &table, const ShotParams &shot, ShotOutcome &outcome)
+{
+	outcome.mPocketed.clear();
+	outcome.mPockets.clear();
+	outcome.mFirstContact	= 0;
+	outcome.mFrames			= 0;
+	outcome.mSettled		= false;
+	mCueBall				= shot.mCueBall;
+
+	// strike the cue ball as GameSession does
+	mEngine.CopyWorld(table);
+	mEngine.Disturb();
+	mEngine.RigidBodyVector3D(shot.mCueBall, Engine::propVeloctity, (shot.mDirection + shot.mPerturbation) * shot.mPower);
+	mEngine.RigidBodyVector3D(shot.mCueBall, Engine::propAngVelocity,
+		mEngine.RigidBodyVector3D(shot.mCueBall, Engine::propAngVelocity) + shot.mSpin);
+}
+
+/*!
+ @param outcome		The one given to Start().
+ @param frameTime	Seconds per Update(); the game uses .05.
+ @param substeps	Steps per Update(); the game uses 5.
+ @param maxFrames	Shots still moving after this many frames are cut off.
+ @param stop		When to hand back, played out or not.
+ @return True once the shot is at rest or cut off.
+*//*__________________________________________________________________________*/
+bool ShotRunner::Step(ShotOutcome &outcome, Real frameTime, int substeps, int maxFrames, Clock::time_point stop)
+{
+	ShotContext context = { mCueBall, &outcome };
+	tShot = &context;
+	while(!mEngine.AtRest() && outcome.mFrames < maxFrames && Clock::now() < stop)
+	{
+		mEngine.Update(frameTime, substeps);
+		++outcome.mFrames;
+	}
+	tShot = 0;
+	outcome.mSettled = mEngine.AtRest();
+	return outcome.mSettled || outcome.mFrames >= maxFrames;
+}
+
+/*!
+ @param workers	Threads to spread the shots over, counting the caller. 0 means one per core.
+*//*__________________________________________________________________________*/
+ShotBatch::ShotBatch(unsigned workers) : mFrameTime(.05f), mSubsteps(5), mMaxFrames(5000)
+{
+	mJobs.Workers(workers);
+}
+/*!
+ @return
+*//*__________________________________________________________________________*/
+ShotBatch::~ShotBatch()
+{
+	for(size_t i = 0; i < mOwned.size(); ++i)
+		delete mOwned[i];
+}
+
+/*!
+ @param table	The engine holding the table to shoot on. Only read here.
+*//*__________________________________________________________________________*/
+void ShotBatch::SetTable(const Engine &table)
+{
+	mTable.CopyWorld(table);
+
+	mBalls.clear();
+	BodyStore &bodies = mTable.mAuxEngine->mBodies;
+	for(uint32_t i = 0; i < bodies.Count(); ++i)
+	{
+		RigidBody* body = bodies.Body(i);
+		if(body->Translatable() && body->mCollideGeom && body->mCollideGeom->Kind() == kC_Sphere)
+			mBalls.push_back(bodies.Handle(i));
+	}
+}
+
+/*!
+ @return A runner no other thread is using.
+*//*__________________________________________________________________________*/
+ShotRunner* ShotBatch::Acquire(void)
+{
+	std::lock_guard< std::mutex > lock(mMutex);
+	if(mRunners.empty())
+	{
+		// one worker: the batch is already spread over the threads
+		ShotRunner* runner = new ShotRunner(mTable.GetParams());
+		mOwned.push_back(runner);
+		return runner;
+	}
+	ShotRunner* runner = mRunners.back();
+	mRunners.pop_back();
+	return runner;
+}
+/*!
+ @param runner	A runner from Acquire().
+*//*__________________________________________________________________________*/
+void ShotBatch::Release(ShotRunner* runner)
+{
+	std::lock_guard< std::mutex > lock(mMutex);
+	mRunners.push_back(runner);
+}
+
+/*!
+ @param runner	Scratch runner to play the shot in.
+ @param shot
+ @param outcome	Filled in.
+*//*__________________________________________________________________________*/
+void ShotBatch::Simulate(ShotRunner &runner, const ShotParams &shot, ShotOutcome &outcome)
+{
+	runner.Start(mTable, shot, outcome);
+	runner.Step(outcome, mFrameTime, mSubsteps, mMaxFrames);
+
+	Engine &engine = runner.GetEngine();
+	outcome.mFinalPositions.resize(mBalls.size());
+	for(size_t i = 0; i < mBalls.size(); ++i)
+		outcome.mFinalPositions[i] = engine.RigidBodyVector3D(mBalls[i], Engine::propPosition);
+}
+
+/*!
+ @param shots		The shots to try, all from the table given to SetTable().
+ @param outcomes	Resized to match shots and filled in.
+*//*__________________________________________________________________________*/
+void ShotBatch::Run(const std::vector< ShotParams > &shots, std::vector< ShotOutcome > &outcomes)
+{
+	outcomes.resize(shots.size());
+	JobPool::RangeFn run = [this, &shots, &outcomes](uint32_t begin, uint32_t end)
+	{
+		ShotRunner* runner = Acquire();
+		for(uint32_t i = begin; i < end; ++i)
+			Simulate(*runner, shots[i], outcomes[i]);
+		Release(runner);
+	};
+	mJobs.ParallelFor((uint32_t)shots.size(), 1, run);
+}
+
+}
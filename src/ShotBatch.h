@@ -0,0 +1,142 @@
+/*!
+	@file	ShotBatch.h
+	@date	October 17, 2026
+
+	@brief	Simulates many candidate shots from one table state.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SHOTBATCH_H__
+#define	__SHOTBATCH_H__
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "PhysicsEngine.h"
+#include "JobPool.h"
+
+namespace Physics
+{
+	/*!
+	 @class		ShotParams
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		One candidate shot: the cue ball leaves with velocity
+				(mDirection + mPerturbation) * mPower, as GameSession strikes it.
+	*//*__________________________________________________________________________*/
+	struct ShotParams
+	{
+		ShotParams() : mCueBall(0), mDirection(), mPower(k1), mPerturbation(), mSpin() {}
+
+		uint32_t	mCueBall;			///< Id of the ball to strike.
+		Vector3D	mDirection;
+		Real		mPower;
+		Vector3D	mPerturbation;		///< Aim error added to mDirection.
+		Vector3D	mSpin;				///< Added to the cue ball's angular velocity.
+	};
+
+	/*!
+	 @class		ShotOutcome
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		What one simulated shot did.
+	*//*__________________________________________________________________________*/
+	struct ShotOutcome
+	{
+		ShotOutcome() : mFirstContact(0), mFrames(0), mSettled(false) {}
+
+		std::vector< uint32_t >	mPocketed;			///< Ids of the balls that reached a pocket, in order.
+		std::vector< uint32_t >	mPockets;			///< Id of the pocket plane each of mPocketed crossed first.
+		uint32_t				mFirstContact;		///< Id of the first ball the cue ball hit, or 0.
+		std::vector< Vector3D >	mFinalPositions;	///< Lined up with ShotBatch::Balls().
+		int						mFrames;			///< Update() calls until rest.
+		bool					mSettled;			///< False if the shot hit mMaxFrames first.
+	};
+
+	/*!
+	 @class		ShotRunner
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Plays one shot at a time out in its own engine.
+
+		Start() resets the engine to a table and strikes the cue ball.
+		Step() runs Update() until the shot comes to rest, reaches its
+		frame limit or runs out of time, and picks up where it stopped
+		when called again, so a search can spread a shot over several
+		calls. Only one thread may use a runner at a time.
+	*//*__________________________________________________________________________*/
+	class ShotRunner
+	{
+	public:
+		typedef std::chrono::steady_clock Clock;
+
+		explicit ShotRunner(const Params &params);
+
+		void		Start(const Engine &table, const ShotParams &shot, ShotOutcome &outcome);
+		bool		Step(ShotOutcome &outcome, Real frameTime, int substeps, int maxFrames,
+						 Clock::time_point stop = Clock::time_point::max());
+		/// The table as the shot has left it so far.
+		Engine&		GetEngine(void)		{ return mEngine; }
+
+	private:
+		// disabled
+		ShotRunner(const ShotRunner &);
+		ShotRunner& operator=(const ShotRunner &);
+
+		Engine		mEngine;
+		uint32_t	mCueBall;
+	};
+
+	/*!
+	 @class		ShotBatch
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Runs candidate shots to rest in private copies of a table.
+
+		SetTable() copies a live engine's world once. Run() then gives every
+		worker thread its own ShotRunner, resets it to that copy before each
+		shot and steps it the way the game loop does (Update(mFrameTime,
+		mSubsteps) until it comes to rest). The live engine is never touched,
+		and each outcome depends only on the table and its shot, not on the
+		thread that ran it.
+	*//*__________________________________________________________________________*/
+	class ShotBatch
+	{
+	public:
+		explicit ShotBatch(unsigned workers = 0);
+		~ShotBatch();
+
+		void		SetTable(const Engine &table);
+		void		Run(const std::vector< ShotParams > &shots, std::vector< ShotOutcome > &outcomes);
+		void		Workers(unsigned count)		{ mJobs.Workers(count); }
+		unsigned	Workers(void) const			{ return mJobs.Workers(); }
+		/// Ids of the free spheres, in the order outcomes report their positions.
+		const std::vector< uint32_t >&	Balls(void) const	{ return mBalls; }
+
+		Real		mFrameTime;			///< Seconds per Update(); the game uses .05.
+		int			mSubsteps;			///< Steps per Update(); the game uses 5.
+		int			mMaxFrames;			///< Shots still moving after this many frames are cut off.
+
+	private:
+		ShotRunner*	Acquire(void);
+		void		Release(ShotRunner* runner);
+		void		Simulate(ShotRunner &runner, const ShotParams &shot, ShotOutcome &outcome);
+
+		// disabled
+		ShotBatch(const ShotBatch &);
+		ShotBatch& operator=(const ShotBatch &);
+
+		Engine						mTable;			///< The saved table.
+		std::vector< uint32_t >		mBalls;
+		std::vector< ShotRunner* >	mRunners;		///< Runners not in use.
+		std::vector< ShotRunner* >	mOwned;
+		std::mutex					mMutex;
+		JobPool						mJobs;
+	};
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*!
+	@file	ShotFeatures.h
+	@date	October 17, 2026
+
+	@brief	The inputs the AI's net scores a shot on.
+
+		AIPlayer and the headless tools work out a shot's features here, so
+		the numbers the net was trained on and the numbers it is shown in a
+		game are the same. Only Geometry is used; nothing here needs the
+		renderer or the game.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SHOTFEATURES_H__
+#define	__SHOTFEATURES_H__
+
+#include <cmath>
+
+#include "Geometry.hpp"
+#include "ShotLog.h"
+
+namespace AI
+{
+	const float ideal_bb = 36.f / 2.25;		///< Cue ball to ghost ball distance that scores 1.
+	const float ideal_bp = 24.f / 2.25f;	///< Object ball to pocket distance that scores 1.
+	const float max_len  = std::sqrt(float((100*100) + (50*50) + (25*25)));
+
+	/*!
+	 @param max		Distances past this score 0.
+	 @param ideal	The distance that scores 1.
+	 @param d
+	 @return d scaled to [0, 1]: rising to 1 at ideal, then falling to 0 at max.
+	*//*__________________________________________________________________________*/
+	inline float convert_distance(float max, float ideal, float d)
+	{
+		if(d > 0.f && d <= ideal)
+			return (d / ideal);
+		else if(d > ideal && d <= max)
+			return (1.f - (d - ideal)/(max - ideal));
+		else
+			return 0.f;
+	}
+
+	/*!
+	 @param ball		Centre of the object ball.
+	 @param pocket		Corner point of the pocket.
+	 @return Where the cue ball's centre must be when it touches the object
+			 ball for the object ball to head straight for the pocket.
+	*//*__________________________________________________________________________*/
+	inline Geometry::Point3D GhostBallPoint(const Geometry::Point3D &ball, const Geometry::Point3D &pocket)
+	{
+		Geometry::Vector3D U(ball - pocket);
+		float len = U.length();
+		if(len <= 0.f)
+			return ball;
+		return ball + U * (2.f / len);
+	}
+
+	/*!
+	 @param cue		Centre of the cue ball.
+	 @param ball	Centre of the object ball.
+	 @param pocket	Corner point of the pocket.
+	 @param inputs	Receives kShotInputs floats: the convert_distance() of the
+					object ball to the pocket, of the cue ball to the ghost
+					ball, and the cosine of the cut angle between the two.
+	 @return The aim, from the cue ball to the ghost ball; not normalized.
+	*//*__________________________________________________________________________*/
+	inline Geometry::Vector3D ShotFeatures(const Geometry::Point3D &cue, const Geometry::Point3D &ball, const Geometry::Point3D &pocket, float* inputs)
+	{
+		Geometry::Vector3D los(pocket - ball);
+		Geometry::Vector3D aim(GhostBallPoint(ball, pocket) - cue);
+		float losLen = los.length();
+		float aimLen = aim.length();
+
+		inputs[0] = convert_distance(max_len, ideal_bp, losLen);
+		inputs[1] = convert_distance(max_len, ideal_bb, aimLen);
+		inputs[2] = (losLen > 0.f && aimLen > 0.f) ? (los * aim) / (losLen * aimLen) : 0.f;
+		return aim;
+	}
+}
+
+#endif
@@ -0,0 +1,42 @@
+/*!
+	@file	ShotLog.h
+	@date	October 17, 2026
+
+	@brief	Binary log of shot features and outcomes, for training the AI's net.
+
+		A ShotLogHeader, then records of mInputs floats (the network inputs
+		AIPlayer scores a shot on) followed by mOutputs floats (what the
+		shot did, 1 or 0). Little-endian, no padding, so a log is read and
+		written a block of records at a time.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SHOTLOG_H__
+#define	__SHOTLOG_H__
+
+#include "StdTypes.h"
+
+namespace AI
+{
+	/// Leads every shot log; bump the version when the layout changes.
+	const uint32_t kShotLogMagic	= 0x4C534843;	// "CHSL"
+	const uint32_t kShotLogVersion	= 1;
+
+	struct ShotLogHeader
+	{
+		uint32_t	mMagic;
+		uint32_t	mVersion;
+		uint32_t	mInputs;		///< Floats of features per record.
+		uint32_t	mOutputs;		///< Floats of outcome per record.
+	};
+
+	/// The inputs SelectShot gives the net: the two convert_distance() values and the cut angle.
+	const uint32_t kShotInputs		= 3;
+	/// The outcome: did the object ball drop in the pocket aimed at.
+	const uint32_t kShotOutputs		= 1;
+}
+
+#endif
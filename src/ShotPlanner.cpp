@@ -0,0 +1,191 @@
+/*!
+	@file	ShotPlanner.cpp
+	@date	October 17, 2026
+
+	@brief	Lists and scores every shot the AI could take from one table.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include "ShotPlanner.h"
+#include "SimdLanes.h"
+
+namespace
+{
+	/// Where the lane padding and the ball being aimed at are parked: far from any path.
+	const float kFar = 1.0e6f;
+}
+
+namespace AI
+{
+const float ShotPlanner::kClearance = 2.f;
+
+/*!
+ @param cue	Centre of the cue ball.
+
+ Forgets the last table's balls, pockets and candidates.
+*//*__________________________________________________________________________*/
+void ShotPlanner::Clear(const Geometry::Point3D &cue)
+{
+	mCue = cue;
+	mX.clear();
+	mY.clear();
+	mZ.clear();
+	mLegal.clear();
+	mPockets.clear();
+}
+
+/*!
+ @param pos		Centre of an object ball on the table.
+ @param legal	True if it may be aimed at; every ball can be in the way.
+ @return Its number in Ball().
+*//*__________________________________________________________________________*/
+uint32_t ShotPlanner::AddBall(const Geometry::Point3D &pos, bool legal)
+{
+	mX.push_back(pos[0]);
+	mY.push_back(pos[1]);
+	mZ.push_back(pos[2]);
+	mLegal.push_back(legal ? 1 : 0);
+	return (uint32_t)mLegal.size() - 1;
+}
+
+/*!
+ @param corner	Corner point of a pocket.
+*//*__________________________________________________________________________*/
+void ShotPlanner::AddPocket(const Geometry::Point3D &corner)
+{
+	mPockets.push_back(corner);
+}
+
+/*!
+ @param from	Start of the path.
+ @param path	From the start to the end.
+ @return How many balls are within kClearance of the path.
+
+ The closest point on the path to each ball is found by clamping the
+ ball's projection onto it; mX, mY and mZ are whole lanes long.
+*//*__________________________________________________________________________*/
+uint32_t ShotPlanner::CountNear(const Geometry::Point3D &from, const Geometry::Vector3D &path) const
+{
+	const uint32_t count = (uint32_t)mX.size();
+	float len2 = ((0.f + path[0] * path[0]) + path[1] * path[1]) + path[2] * path[2];
+	float inv = len2 > 0.f ? 1.f / len2 : 0.f;
+	float clear2 = kClearance * kClearance;
+	uint32_t hits = 0, i = 0;
+
+#if defined( CH_SIMD_SSE2 )
+	namespace Simd = Physics::Simd;
+	const Simd::Lane ax = Simd::Splat(from[0]), ay = Simd::Splat(from[1]), az = Simd::Splat(from[2]);
+	const Simd::Lane dx = Simd::Splat(path[0]), dy = Simd::Splat(path[1]), dz = Simd::Splat(path[2]);
+	const Simd::Lane lInv = Simd::Splat(inv), lClear = Simd::Splat(clear2);
+	const Simd::Lane zero = Simd::Zero(), one = Simd::Splat(1.f);
+	Simd::Lane total = Simd::Zero();
+	for(; i + Simd::kLaneWidth <= count; i += Simd::kLaneWidth)
+	{
+		Simd::Lane wx = Simd::Sub(Simd::Load(&mX[i]), ax);
+		Simd::Lane wy = Simd::Sub(Simd::Load(&mY[i]), ay);
+		Simd::Lane wz = Simd::Sub(Simd::Load(&mZ[i]), az);
+		Simd::Lane t = Simd::Mul(Simd::Dot(wx, wy, wz, dx, dy, dz), lInv);
+		t = Simd::Min(Simd::Max(t, zero), one);
+		wx = Simd::Sub(wx, Simd::Mul(t, dx));
+		wy = Simd::Sub(wy, Simd::Mul(t, dy));
+		wz = Simd::Sub(wz, Simd::Mul(t, dz));
+		Simd::Lane near = Simd::Less(Simd::Dot(wx, wy, wz, wx, wy, wz), lClear);
+		total = Simd::Add(total, Simd::And(near, one));
+	}
+	float lanes[Simd::kLaneWidth];
+	Simd::Store(lanes, total);
+	for(uint32_t k = 0; k < Simd::kLaneWidth; ++k)
+		hits += (uint32_t)lanes[k];
+#endif
+	for(; i < count; ++i)
+	{
+		float wx = mX[i] - from[0], wy = mY[i] - from[1], wz = mZ[i] - from[2];
+		float t = (((0.f + wx * path[0]) + wy * path[1]) + wz * path[2]) * inv;
+		t = t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+		wx -= t * path[0];
+		wy -= t * path[1];
+		wz -= t * path[2];
+		if(((0.f + wx * wx) + wy * wy) + wz * wz < clear2)
+			++hits;
+	}
+	return hits;
+}
+
+/*!
+ @param net	Scores the candidates; 0 leaves every score 0.
+*//*__________________________________________________________________________*/
+void ShotPlanner::Plan(NeuralNet* net)
+{
+	const uint32_t balls = (uint32_t)mLegal.size();
+	const uint32_t pockets = (uint32_t)mPockets.size();
+
+	// features: one row per legal ball and pocket
+	mBall.clear();
+	mPocket.clear();
+	mAim.clear();
+	mInputs.clear();
+	for(uint32_t b = 0; b < balls; ++b)
+	{
+		if(!mLegal[b])
+			continue;
+		Geometry::Point3D pos(mX[b], mY[b], mZ[b]);
+		for(uint32_t p = 0; p < pockets; ++p)
+		{
+			float inputs[kShotInputs];
+			mBall.push_back(b);
+			mPocket.push_back(p);
+			mAim.push_back(ShotFeatures(mCue, pos, mPockets[p], inputs));
+			mInputs.insert(mInputs.end(), inputs, inputs + kShotInputs);
+		}
+	}
+	const uint32_t count = Count();
+
+	// obstruction: every path against every ball; the one aimed at is parked out of the way
+#if defined( CH_SIMD_SSE2 )
+	const uint32_t width = Physics::Simd::kLaneWidth;
+#else
+	const uint32_t width = 1;
+#endif
+	uint32_t padded = (balls + width - 1) / width * width;
+	mX.resize(padded, kFar);
+	mY.resize(padded, kFar);
+	mZ.resize(padded, kFar);
+	mBlockers.resize(count);
+	for(uint32_t i = 0; i < count; )
+	{
+		uint32_t b = mBall[i];
+		Geometry::Point3D pos(mX[b], mY[b], mZ[b]);
+		mX[b] = mY[b] = mZ[b] = kFar;
+		for(; i < count && mBall[i] == b; ++i)
+			mBlockers[i] = CountNear(pos, mPockets[mPocket[i]] - pos) + CountNear(mCue, mAim[i]);
+		mX[b] = pos[0];
+		mY[b] = pos[1];
+		mZ[b] = pos[2];
+	}
+	mX.resize(balls);
+	mY.resize(balls);
+	mZ.resize(balls);
+
+	// scores: the whole table in one batch
+	mOutputs = net ? net->OutputCount() : 1;
+	mScores.assign((size_t)count * mOutputs, 0.f);
+	if(net && count)
+		net->RunBatch(&mInputs[0], (int)count, &mScores[0]);
+}
+
+/*!
+ @return The candidate with the highest score, the last of them on a tie;
+		 Count() if there are none.
+*//*__________________________________________________________________________*/
+uint32_t ShotPlanner::Best(void) const
+{
+	uint32_t best = Count();
+	for(uint32_t i = 0; i < Count(); ++i)
+	{
+		if(best == Count() || Score(i) >= Score(best))
+			best = i;
+	}
+	return best;
+}
+}
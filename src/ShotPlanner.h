@@ -0,0 +1,94 @@
+/*!
+	@file	ShotPlanner.h
+	@date	October 17, 2026
+
+	@brief	Lists and scores every shot the AI could take from one table.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SHOTPLANNER_H__
+#define	__SHOTPLANNER_H__
+
+#include <vector>
+
+#include "ShotFeatures.h"
+#include "ANN.h"
+
+namespace AI
+{
+	/*!
+	 @class		ShotPlanner
+	 @ingroup	ANN
+	 @date		10-17-2026
+	 @brief		The candidate shots of one table, in three passes.
+
+		Give it the cue ball, the object balls on the table (which of them
+		may be aimed at) and the pockets, then Plan(). One candidate is a
+		legal ball and a pocket, in ball-then-pocket order:
+
+		  1. Features: each candidate's ShotFeatures() and aim, once.
+		  2. Obstruction: how many other balls lie across the object ball's
+		     path to the pocket or the cue ball's path to the ghost ball,
+		     each path tested against every ball in lanes (see SimdLanes.h).
+		  3. Scores: one NeuralNet::RunBatch() over every candidate.
+
+		The planner keeps its arrays between tables, so planning a shot
+		does not allocate once they have grown to the biggest table.
+	*//*__________________________________________________________________________*/
+	class ShotPlanner
+	{
+	public:
+		/// Balls closer than this to a path, centre to path, are in its way.
+		static const float kClearance;
+
+		ShotPlanner() : mOutputs(1) {}
+
+		void		Clear(const Geometry::Point3D &cue);
+		uint32_t	AddBall(const Geometry::Point3D &pos, bool legal);
+		void		AddPocket(const Geometry::Point3D &corner);
+		void		Plan(NeuralNet* net);
+
+		/// Balls and pockets as given, before any Plan().
+		uint32_t	BallCount(void) const				{ return (uint32_t)mLegal.size(); }
+		bool		Legal(uint32_t b) const				{ return mLegal[b] != 0; }
+		uint32_t	PocketCount(void) const				{ return (uint32_t)mPockets.size(); }
+		const Geometry::Point3D&	Corner(uint32_t p) const	{ return mPockets[p]; }
+
+		uint32_t	Count(void) const					{ return (uint32_t)mBall.size(); }
+		/// Which AddBall() the candidate shoots at, counting from 0.
+		uint32_t	Ball(uint32_t i) const				{ return mBall[i]; }
+		/// Which AddPocket() it shoots into, counting from 0.
+		uint32_t	Pocket(uint32_t i) const			{ return mPocket[i]; }
+		/// kShotInputs floats; rows are back to back from Inputs(0).
+		const float*	Inputs(uint32_t i) const		{ return &mInputs[i * kShotInputs]; }
+		/// From the cue ball to the ghost ball; not normalized.
+		const Geometry::Vector3D&	Aim(uint32_t i) const	{ return mAim[i]; }
+		Geometry::Point3D	Ghost(uint32_t i) const		{ return mCue + mAim[i]; }
+		uint32_t	Blockers(uint32_t i) const			{ return mBlockers[i]; }
+		/// The net's first output, or 0 if Plan() was given no net.
+		float		Score(uint32_t i) const				{ return mScores[i * mOutputs]; }
+		uint32_t	Best(void) const;
+
+	private:
+		uint32_t	CountNear(const Geometry::Point3D &from, const Geometry::Vector3D &path) const;
+
+		Geometry::Point3D					mCue;
+		std::vector< float >				mX, mY, mZ;		///< Object balls, padded to whole lanes.
+		std::vector< uint8_t >				mLegal;
+		std::vector< Geometry::Point3D >	mPockets;
+
+		// one entry per candidate
+		std::vector< uint32_t >				mBall;
+		std::vector< uint32_t >				mPocket;
+		std::vector< float >				mInputs;
+		std::vector< Geometry::Vector3D >	mAim;
+		std::vector< uint32_t >				mBlockers;
+		std::vector< float >				mScores;		///< mOutputs per candidate.
+		int									mOutputs;
+	};
+}
+
+#endif
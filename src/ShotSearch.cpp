@@ -0,0 +1,364 @@
+/*!
+	@file	ShotSearch.cpp
+	@date	October 17, 2026
+
+	@brief	Refines the AI's best-scored shots by playing them out.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "ShotSearch.h"
+
+namespace
+{
+	/// Orders candidates clear ones first, then best score first, then as the planner listed them.
+	struct ClearThenScore
+	{
+		explicit ClearThenScore(const AI::ShotPlanner &planner) : mPlanner(planner) {}
+		bool operator()(uint32_t a, uint32_t b) const
+		{
+			bool clearA = mPlanner.Blockers(a) == 0, clearB = mPlanner.Blockers(b) == 0;
+			if(clearA != clearB)
+				return clearA;
+			return mPlanner.Score(a) > mPlanner.Score(b);
+		}
+		const AI::ShotPlanner &mPlanner;
+	};
+}
+
+namespace AI
+{
+/*!
+ @param workers	Threads to play shots on, counting the caller. 0 means one per core.
+*//*__________________________________________________________________________*/
+ShotSearch::ShotSearch(unsigned workers) : mNet(0), mCue(0), mCount(0), mDefault(0), mDefaultScore(0.f), mNext(0), mTried(0)
+{
+	mJobs.Workers(workers);
+	mDeadline = Clock::now();
+}
+/*!
+ @return
+*//*__________________________________________________________________________*/
+ShotSearch::~ShotSearch()
+{
+	Clear();
+}
+
+/*!
+ @param count	Threads to play shots on, counting the caller. 0 means one per core.
+
+ Drops any search in progress.
+*//*__________________________________________________________________________*/
+void ShotSearch::Workers(unsigned count)
+{
+	Clear();
+	mTrials.clear();
+	mJobs.Workers(count);
+}
+
+/// Frees every worker's runner and net.
+void ShotSearch::Clear(void)
+{
+	for(size_t i = 0; i < mLanes.size(); ++i)
+	{
+		delete mLanes[i].mRunner;
+		delete mLanes[i].mNet;
+	}
+	mLanes.clear();
+}
+
+/*!
+ @param table		The engine holding the table, at rest; copied.
+ @param planner		Planned on the same table.
+ @param net			Scores the tables the shots leave; copied. 0 scores them all 0.
+ @param cue			Engine id of the cue ball.
+ @param balls		Engine id of each of the planner's balls, in its order.
+ @param planes		Engine ids of the planes the pockets are made of...
+ @param pocketOf	...and, for each, which of the planner's pockets it is part of.
+					Balls that cross planes of no pocket aimed at still leave the table.
+ @param params
+
+ Forgets the last search and starts the clock on this one.
+*//*__________________________________________________________________________*/
+void ShotSearch::Start(const Physics::Engine &table, const ShotPlanner &planner, NeuralNet* net, uint32_t cue,
+					   const std::vector< uint32_t > &balls, const std::vector< uint32_t > &planes,
+					   const std::vector< uint32_t > &pocketOf, const SearchParams &params)
+{
+	mTable.CopyWorld(table);
+	mParams		= params;
+	mNet		= net;
+	mCue		= cue;
+	mBalls		= balls;
+	mPlanes		= planes;
+	mPocketOf	= pocketOf;
+	mLegal.resize(planner.BallCount());
+	for(uint32_t b = 0; b < planner.BallCount(); ++b)
+		mLegal[b] = planner.Legal(b) ? 1 : 0;
+	mCorners.resize(planner.PocketCount());
+	for(uint32_t p = 0; p < planner.PocketCount(); ++p)
+		mCorners[p] = planner.Corner(p);
+	mCount		= planner.Count();
+	mDefault	= planner.Best();
+	if(mDefault < mCount)
+	{
+		mDefaultScore	= planner.Score(mDefault);
+		mDefaultGhost	= planner.Ghost(mDefault);
+		mDefaultAim		= planner.Aim(mDefault);
+	}
+
+	// the best candidates; stable, so equal ones stay in the planner's order
+	std::vector< uint32_t > candidates(mCount);
+	for(uint32_t i = 0; i < mCount; ++i)
+		candidates[i] = i;
+	std::stable_sort(candidates.begin(), candidates.end(), ClearThenScore(planner));
+	if((int)candidates.size() > mParams.mCandidates)
+		candidates.resize(std::max(0, mParams.mCandidates));
+
+	// every candidate as it would be shot, then softer and harder, then with spin
+	// if the ContactSolver runs, since only its friction makes much of the spin
+	mTrials.clear();
+	AddTrials(planner, candidates, mParams.mPower, 0.f, 0.f);
+	AddTrials(planner, candidates, mParams.mPower * .75f, 0.f, 0.f);
+	AddTrials(planner, candidates, mParams.mPower * 1.25f, 0.f, 0.f);
+	if(mTable.GetParams().mSolverIterations > 0)
+	{
+		AddTrials(planner, candidates, mParams.mPower, 1.f, 0.f);
+		AddTrials(planner, candidates, mParams.mPower, -1.f, 0.f);
+		AddTrials(planner, candidates, mParams.mPower, 0.f, 1.f);
+		AddTrials(planner, candidates, mParams.mPower, 0.f, -1.f);
+	}
+	mValues.assign(mTrials.size(), 0.f);
+	mPlayed.assign(mTrials.size(), 0);
+	mNext	= 0;
+	mTried	= 0;
+
+	// one lane per worker; a lane's runner takes the table's params on its first Start()
+	unsigned lanes = mJobs.Workers();
+	if(mLanes.size() != lanes)
+	{
+		Clear();
+		mLanes.resize(lanes);
+	}
+	for(size_t i = 0; i < mLanes.size(); ++i)
+	{
+		Lane &lane = mLanes[i];
+		if(!lane.mRunner)
+			lane.mRunner = new Physics::ShotRunner(mTable.GetParams());
+		delete lane.mNet;
+		lane.mNet	= net ? new NeuralNet(*net) : 0;
+		lane.mTrial	= -1;
+	}
+
+	mDeadline = Clock::now() + std::chrono::microseconds((long long)(mParams.mBudgetMs * 1000.f));
+}
+
+/*!
+ @param planner
+ @param candidates	Which of the planner's candidates.
+ @param power		Speed to strike the cue ball at.
+ @param top			Spin about the axis across the aim, as a fraction of mSpin: rolls the cue ball on or back.
+ @param side		Spin about the axis square to both: turns it left or right off a cushion.
+*//*__________________________________________________________________________*/
+void ShotSearch::AddTrials(const ShotPlanner &planner, const std::vector< uint32_t > &candidates, float power, float top, float side)
+{
+	for(size_t i = 0; i < candidates.size(); ++i)
+	{
+		uint32_t c = candidates[i];
+		Trial trial;
+		trial.mCandidate	= c;
+		trial.mBall			= mBalls[planner.Ball(c)];
+		trial.mPocket		= planner.Pocket(c);
+		trial.mScore		= planner.Score(c);
+		trial.mGhost		= planner.Ghost(c);
+		trial.mPower		= power;
+
+		// the table has no up, so any axis will do that is not along the aim
+		Geometry::Vector3D aim(planner.Aim(c));
+		if(aim.length() <= 0.f)
+			continue;
+		trial.mAim = aim.normal();
+		Geometry::Vector3D ref = std::fabs(trial.mAim[1]) < .9f ? Geometry::Vector3D(0, 1, 0) : Geometry::Vector3D(1, 0, 0);
+		Geometry::Vector3D across = (trial.mAim ^ ref).normal();
+		Geometry::Vector3D square = across ^ trial.mAim;
+		trial.mSpin = across * (top * mParams.mSpin) + square * (side * mParams.mSpin);
+		mTrials.push_back(trial);
+	}
+}
+
+/*!
+ @param ms	Most milliseconds to spend, less if the budget runs out first.
+ @return Done().
+
+ Each worker plays the shot it has in hand on, then takes the next one,
+ until time is up; a shot not at rest by then is carried on next call.
+*//*__________________________________________________________________________*/
+bool ShotSearch::Run(float ms)
+{
+	if(Done())
+		return true;
+
+	Clock::time_point stop = std::min(mDeadline, Clock::now() + std::chrono::microseconds((long long)(ms * 1000.f)));
+	Physics::JobPool::RangeFn play = [&](uint32_t begin, uint32_t end)
+	{
+		for(uint32_t i = begin; i < end; ++i)
+			Play(mLanes[i], stop);
+	};
+	mJobs.ParallelFor((uint32_t)mLanes.size(), 1, play);
+	return Done();
+}
+
+/*!
+ @return True once every shot has been played out or the budget has run out.
+*//*__________________________________________________________________________*/
+bool ShotSearch::Done(void) const
+{
+	if(Clock::now() >= mDeadline)
+		return true;
+	if(mNext < mTrials.size())
+		return false;
+	for(size_t i = 0; i < mLanes.size(); ++i)
+	{
+		if(mLanes[i].mTrial >= 0)
+			return false;
+	}
+	return true;
+}
+
+/*!
+ @param lane
+ @param stop	When to hand the lane back, played out or not.
+*//*__________________________________________________________________________*/
+void ShotSearch::Play(Lane &lane, Clock::time_point stop)
+{
+	for(;;)
+	{
+		if(lane.mTrial < 0)
+		{
+			{
+				std::lock_guard< std::mutex > lock(mMutex);
+				if(mNext >= mTrials.size())
+					return;
+				lane.mTrial = (int)mNext++;
+			}
+
+			const Trial &trial = mTrials[lane.mTrial];
+			Physics::ShotParams shot;
+			shot.mCueBall	= mCue;
+			shot.mDirection	= trial.mAim;
+			shot.mPower		= trial.mPower;
+			shot.mSpin		= trial.mSpin;
+			lane.mRunner->Start(mTable, shot, lane.mOutcome);
+		}
+
+		if(!lane.mRunner->Step(lane.mOutcome, mParams.mFrameTime, mParams.mSubsteps, mParams.mMaxFrames, stop))
+			return;
+
+		float value = Value(lane, mTrials[lane.mTrial]);
+		{
+			std::lock_guard< std::mutex > lock(mMutex);
+			mValues[lane.mTrial] = value;
+			mPlayed[lane.mTrial] = 1;
+			++mTried;
+		}
+		lane.mTrial = -1;
+		if(Clock::now() >= stop)
+			return;
+	}
+}
+
+/*!
+ @param lane	Holding the table the shot left.
+ @param trial	The shot.
+ @return What the shot was worth; see the class.
+*//*__________________________________________________________________________*/
+float ShotSearch::Value(Lane &lane, const Trial &trial)
+{
+	const std::vector< uint32_t > &dropped = lane.mOutcome.mPocketed;
+	bool made = false;
+	for(size_t i = 0; i < dropped.size(); ++i)
+	{
+		if(dropped[i] == mCue)
+			return -1.f;
+		if(dropped[i] == trial.mBall && PocketOf(lane.mOutcome.mPockets[i]) == trial.mPocket)
+			made = true;
+	}
+	if(!made || !lane.mOutcome.mSettled)
+		return 0.f;
+
+	// the best shot the table leaves, without the balls that dropped
+	Physics::Engine &engine = lane.mRunner->GetEngine();
+	Geometry::Vector3D c = engine.RigidBodyVector3D(mCue, Physics::Engine::propPosition);
+	lane.mPlanner.Clear(Geometry::Point3D(c[0], c[1], c[2]));
+	for(size_t b = 0; b < mBalls.size(); ++b)
+	{
+		if(std::find(dropped.begin(), dropped.end(), mBalls[b]) != dropped.end())
+			continue;
+		Geometry::Vector3D pos = engine.RigidBodyVector3D(mBalls[b], Physics::Engine::propPosition);
+		lane.mPlanner.AddBall(Geometry::Point3D(pos[0], pos[1], pos[2]), mLegal[b] != 0);
+	}
+	for(size_t p = 0; p < mCorners.size(); ++p)
+		lane.mPlanner.AddPocket(mCorners[p]);
+	lane.mPlanner.Plan(lane.mNet);
+	uint32_t next = lane.mPlanner.Best();
+	return 1.f + mParams.mNextWeight * (next < lane.mPlanner.Count() ? lane.mPlanner.Score(next) : 0.f);
+}
+
+/*!
+ @param plane	Engine id of a plane a ball crossed.
+ @return The planner's number for its pocket, or the planner's pocket count if it is none of them.
+*//*__________________________________________________________________________*/
+uint32_t ShotSearch::PocketOf(uint32_t plane) const
+{
+	for(size_t i = 0; i < mPlanes.size(); ++i)
+	{
+		if(mPlanes[i] == plane)
+			return mPocketOf[i];
+	}
+	return (uint32_t)mCorners.size();
+}
+
+/*!
+ @return The best shot played out so far, or the planner's pick if none
+		 has been; its mCandidate is the planner's Count() if the table had
+		 no candidates at all.
+*//*__________________________________________________________________________*/
+SearchResult ShotSearch::Result(void) const
+{
+	SearchResult result;
+	result.mTried = mTried;
+
+	int best = -1;
+	for(size_t i = 0; i < mTrials.size(); ++i)
+	{
+		if(mPlayed[i] && (best < 0 || mValues[i] > mValues[best]))
+			best = (int)i;
+	}
+	if(best >= 0)
+	{
+		const Trial &trial = mTrials[best];
+		result.mCandidate	= trial.mCandidate;
+		result.mScore		= trial.mScore;
+		result.mGhost		= trial.mGhost;
+		result.mAim			= trial.mAim;
+		result.mPower		= trial.mPower;
+		result.mSpin		= trial.mSpin;
+		result.mValue		= mValues[best];
+		result.mPlayed		= true;
+		return result;
+	}
+
+	result.mCandidate	= mDefault;
+	result.mPower		= mParams.mPower;
+	if(mDefault < mCount)
+	{
+		result.mScore	= mDefaultScore;
+		result.mGhost	= mDefaultGhost;
+		if(mDefaultAim.length() > 0.f)
+			result.mAim = mDefaultAim.normal();
+	}
+	return result;
+}
+}
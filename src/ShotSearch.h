@@ -0,0 +1,177 @@
+/*!
+	@file	ShotSearch.h
+	@date	October 17, 2026
+
+	@brief	Refines the AI's best-scored shots by playing them out.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SHOTSEARCH_H__
+#define	__SHOTSEARCH_H__
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "PhysicsEngine.h"
+#include "JobPool.h"
+#include "ShotBatch.h"
+#include "ShotPlanner.h"
+
+namespace AI
+{
+	/*!
+	 @class		SearchParams
+	 @ingroup	ANN
+	 @date		10-17-2026
+	 @brief		How long and how wide ShotSearch looks.
+	*//*__________________________________________________________________________*/
+	struct SearchParams
+	{
+		SearchParams() : mBudgetMs(0.f), mCandidates(8), mPower(60.f), mSpin(10.f), mNextWeight(.5f),
+			mFrameTime(.05f), mSubsteps(5), mMaxFrames(5000) {}
+
+		float	mBudgetMs;			///< Wall time from Start() to the answer; 0 plays out nothing.
+		int		mCandidates;		///< How many of the planner's best candidates are played out.
+		float	mPower;				///< Speed the game strikes the AI's shots at; the search also tries 3/4 and 5/4 of it.
+		float	mSpin;				///< Cue ball spin tried, in radians per second, when the table has mSolverIterations.
+		float	mNextWeight;		///< Worth of the best next shot, as a fraction of dropping this one.
+		Real	mFrameTime;			///< Seconds per Update(); the game uses .05.
+		int		mSubsteps;			///< Steps per Update(); the game uses 5.
+		int		mMaxFrames;			///< Shots still moving after this many frames count as misses.
+	};
+
+	/*!
+	 @class		SearchResult
+	 @ingroup	ANN
+	 @date		10-17-2026
+	 @brief		The shot a search settled on.
+	*//*__________________________________________________________________________*/
+	struct SearchResult
+	{
+		SearchResult() : mCandidate(0), mScore(0.f), mPower(0.f), mValue(0.f), mTried(0), mPlayed(false) {}
+
+		uint32_t			mCandidate;		///< Which of the planner's candidates.
+		float				mScore;			///< The net's score for it.
+		Geometry::Point3D	mGhost;			///< Where the cue ball meets the object ball.
+		Geometry::Vector3D	mAim;			///< Normalized.
+		float				mPower;
+		Geometry::Vector3D	mSpin;			///< Cue ball angular velocity.
+		float				mValue;			///< See ShotSearch; 0 if it was never played out.
+		uint32_t			mTried;			///< Shots played out to rest before this was chosen.
+		bool				mPlayed;		///< False if it is the planner's pick, unplayed.
+	};
+
+	/*!
+	 @class		ShotSearch
+	 @ingroup	ANN
+	 @date		10-17-2026
+	 @brief		An anytime search over the planner's best candidates.
+
+		Start() copies the table and queues shots to try: each of the
+		planner's mCandidates best candidates (those with nothing in the
+		way first), struck at the usual power, then at softer and harder
+		power, then, if the table's ContactSolver runs and so gives the
+		balls friction, with top, back and left and right side spin.
+		Every candidate's plain shot is queued before any variation of
+		one.
+
+		Run() plays queued shots out in private copies of the table,
+		stepped as the game steps it, for at most the time it is given,
+		and can be called again to carry on where it stopped; a shot that
+		is still rolling when time is up is picked up next call. Workers
+		each play their own shot. A shot that drops the ball it was aimed
+		at into the pocket aimed at, and keeps the cue ball on the table,
+		is worth 1 plus mNextWeight times the best net score of the
+		table it leaves; a scratch is worth -1; anything else 0.
+
+		Result() is the best shot played so far, earliest first on a tie,
+		or the planner's pick if none has come to rest. The search is
+		over once every shot is played out or mBudgetMs has passed since
+		Start(), whichever is first, so calling Run() with a few
+		milliseconds each frame never holds the frame up for longer.
+	*//*__________________________________________________________________________*/
+	class ShotSearch
+	{
+	public:
+		explicit ShotSearch(unsigned workers = 1);
+		~ShotSearch();
+
+		void		Start(const Physics::Engine &table, const ShotPlanner &planner, NeuralNet* net, uint32_t cue,
+						  const std::vector< uint32_t > &balls, const std::vector< uint32_t > &planes,
+						  const std::vector< uint32_t > &pocketOf, const SearchParams &params);
+		bool		Run(float ms);
+		bool		Done(void) const;
+		SearchResult	Result(void) const;
+
+		void		Workers(unsigned count);
+		unsigned	Workers(void) const		{ return mJobs.Workers(); }
+
+	private:
+		/// One shot to play out.
+		struct Trial
+		{
+			uint32_t			mCandidate;
+			uint32_t			mBall;		///< Engine id of the ball aimed at.
+			uint32_t			mPocket;	///< The planner's number for the pocket.
+			float				mScore;
+			Geometry::Point3D	mGhost;
+			Geometry::Vector3D	mAim;
+			float				mPower;
+			Geometry::Vector3D	mSpin;
+		};
+
+		/// A worker's shot in play, kept between Run() calls.
+		struct Lane
+		{
+			Lane() : mRunner(0), mNet(0), mTrial(-1) {}
+			Physics::ShotRunner*	mRunner;
+			NeuralNet*				mNet;		///< Own copy, since running it uses its scratch.
+			ShotPlanner				mPlanner;
+			int						mTrial;		///< -1 when free.
+			Physics::ShotOutcome	mOutcome;	///< Of mTrial, so far.
+		};
+
+		typedef Physics::ShotRunner::Clock Clock;
+
+		void		AddTrials(const ShotPlanner &planner, const std::vector< uint32_t > &candidates, float power, float top, float side);
+		void		Play(Lane &lane, Clock::time_point stop);
+		float		Value(Lane &lane, const Trial &trial);
+		uint32_t	PocketOf(uint32_t plane) const;
+		void		Clear(void);
+
+		// disabled
+		ShotSearch(const ShotSearch &);
+		ShotSearch& operator=(const ShotSearch &);
+
+		Physics::Engine						mTable;
+		SearchParams						mParams;
+		NeuralNet*							mNet;
+		uint32_t							mCue;
+		std::vector< uint32_t >				mBalls;		///< Engine ids, in the planner's ball order.
+		std::vector< uint8_t >				mLegal;
+		std::vector< uint32_t >				mPlanes;	///< Engine ids of the planes pockets are made of...
+		std::vector< uint32_t >				mPocketOf;	///< ...and the planner's number for the pocket of each.
+		std::vector< Geometry::Point3D >	mCorners;
+		uint32_t							mCount;		///< The planner's candidates.
+		uint32_t							mDefault;	///< The planner's pick; mCount if none.
+		float								mDefaultScore;
+		Geometry::Point3D					mDefaultGhost;
+		Geometry::Vector3D					mDefaultAim;
+
+		std::vector< Trial >				mTrials;
+		std::vector< float >				mValues;	///< Per trial, once played.
+		std::vector< uint8_t >				mPlayed;
+		uint32_t							mNext;		///< First trial no lane has taken.
+		uint32_t							mTried;
+		Clock::time_point					mDeadline;
+		std::vector< Lane >					mLanes;
+		std::mutex							mMutex;
+		Physics::JobPool					mJobs;
+	};
+}
+
+#endif
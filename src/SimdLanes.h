@@ -0,0 +1,91 @@
+/*!
+	@file	SimdLanes.h
+	@date	October 17, 2026
+
+	@brief	Structure-of-arrays lanes for the batched kernels.
+
+		A Lane holds one float from each of four (SSE2) or eight (AVX)
+		items, so a kernel runs the scalar code's exact steps on several
+		items at once. Only defined when SimdVector.h picked SSE2.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SIMDLANES_H__
+#define	__SIMDLANES_H__
+
+#include "SimdVector.h"
+
+#if defined( CH_SIMD_SSE2 ) && defined( __AVX__ )
+#include <immintrin.h>
+#endif
+
+#if defined( CH_SIMD_SSE2 )
+namespace Physics
+{
+namespace Simd
+{
+	// One register of lanes, and the few operations the batched kernels need.
+	// Compares return all-ones or all-zero masks; NaN compares false, as in C.
+#if defined( __AVX__ )
+	typedef __m256 Lane;
+	const uint32_t kLaneWidth = 8;
+
+	inline Lane Load(const Real* p)				{ return _mm256_loadu_ps(p); }
+	inline void Store(Real* p, Lane v)			{ _mm256_storeu_ps(p, v); }
+	inline void StoreMask(uint32_t* p, Lane m)	{ _mm256_storeu_ps(reinterpret_cast< float* >(p), m); }
+	inline Lane Zero(void)						{ return _mm256_setzero_ps(); }
+	inline Lane Splat(Real s)					{ return _mm256_set1_ps(s); }
+	inline Lane Add(Lane a, Lane b)				{ return _mm256_add_ps(a, b); }
+	inline Lane Sub(Lane a, Lane b)				{ return _mm256_sub_ps(a, b); }
+	inline Lane Mul(Lane a, Lane b)				{ return _mm256_mul_ps(a, b); }
+	inline Lane Div(Lane a, Lane b)				{ return _mm256_div_ps(a, b); }
+	inline Lane Sqrt(Lane a)					{ return _mm256_sqrt_ps(a); }
+	inline Lane Min(Lane a, Lane b)				{ return _mm256_min_ps(a, b); }
+	inline Lane Max(Lane a, Lane b)				{ return _mm256_max_ps(a, b); }
+	inline Lane Xor(Lane a, Lane b)				{ return _mm256_xor_ps(a, b); }
+	inline Lane And(Lane a, Lane b)				{ return _mm256_and_ps(a, b); }
+	inline Lane AndNot(Lane a, Lane b)			{ return _mm256_andnot_ps(a, b); }
+	inline Lane Or(Lane a, Lane b)				{ return _mm256_or_ps(a, b); }
+	inline Lane Less(Lane a, Lane b)			{ return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	inline Lane LessEqual(Lane a, Lane b)		{ return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	inline Lane GreaterEqual(Lane a, Lane b)	{ return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	inline Lane NotEqual(Lane a, Lane b)		{ return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+#else
+	typedef __m128 Lane;
+	const uint32_t kLaneWidth = 4;
+
+	inline Lane Load(const Real* p)				{ return _mm_loadu_ps(p); }
+	inline void Store(Real* p, Lane v)			{ _mm_storeu_ps(p, v); }
+	inline void StoreMask(uint32_t* p, Lane m)	{ _mm_storeu_ps(reinterpret_cast< float* >(p), m); }
+	inline Lane Zero(void)						{ return _mm_setzero_ps(); }
+	inline Lane Splat(Real s)					{ return _mm_set1_ps(s); }
+	inline Lane Add(Lane a, Lane b)				{ return _mm_add_ps(a, b); }
+	inline Lane Sub(Lane a, Lane b)				{ return _mm_sub_ps(a, b); }
+	inline Lane Mul(Lane a, Lane b)				{ return _mm_mul_ps(a, b); }
+	inline Lane Div(Lane a, Lane b)				{ return _mm_div_ps(a, b); }
+	inline Lane Sqrt(Lane a)					{ return _mm_sqrt_ps(a); }
+	inline Lane Min(Lane a, Lane b)				{ return _mm_min_ps(a, b); }
+	inline Lane Max(Lane a, Lane b)				{ return _mm_max_ps(a, b); }
+	inline Lane Xor(Lane a, Lane b)				{ return _mm_xor_ps(a, b); }
+	inline Lane And(Lane a, Lane b)				{ return _mm_and_ps(a, b); }
+	inline Lane AndNot(Lane a, Lane b)			{ return _mm_andnot_ps(a, b); }
+	inline Lane Or(Lane a, Lane b)				{ return _mm_or_ps(a, b); }
+	inline Lane Less(Lane a, Lane b)			{ return _mm_cmplt_ps(a, b); }
+	inline Lane LessEqual(Lane a, Lane b)		{ return _mm_cmple_ps(a, b); }
+	inline Lane GreaterEqual(Lane a, Lane b)	{ return _mm_cmpge_ps(a, b); }
+	inline Lane NotEqual(Lane a, Lane b)		{ return _mm_cmpneq_ps(a, b); }
+#endif
+
+	/// ((0 + x) + y) + z, as Geometry::Dot does it.
+	inline Lane Dot(Lane ax, Lane ay, Lane az, Lane bx, Lane by, Lane bz)
+	{
+		return Add(Add(Add(Zero(), Mul(ax, bx)), Mul(ay, by)), Mul(az, bz));
+	}
+}
+}
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+/*!
+	@file	SimdVector.h
+	@date	October 17, 2026
+
+	@brief	Single-precision SIMD vector for the physics inner loops.
+
+		SSE2 is the baseline (every x64 target, and Win32 with the default
+		/arch:SSE2). Define CH_NO_SIMD to force the plain C++ version.
+		Building with AVX2 enabled (the CH_AVX2 CMake option) lets the
+		compiler use the VEX forms of the same intrinsics.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SIMDVECTOR_H__
+#define	__SIMDVECTOR_H__
+
+#include <cmath>
+
+#include "MathDefs.h"
+#include "Geometry.hpp"
+
+#if !defined( CH_NO_SIMD ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+#define CH_SIMD_SSE2	1
+#include <emmintrin.h>
+#endif
+
+namespace Physics
+{
+	/*!
+	 @class		Vec3f
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		A 3D float vector held in one 16 byte register (w is kept 0).
+
+		Load() and Store() move to and from Geometry::Vector3D without
+		touching memory past its three floats, so they work on the body
+		store's packed arrays. Every operation rounds the same way as the
+		matching Vector3D one, Dot() sums in the same order, and there are
+		no fused multiply-adds, so results match the scalar code bit for bit.
+
+		Pass by const reference: 32-bit MSVC cannot pass aligned types by value.
+	*//*__________________________________________________________________________*/
+	class Vec3f
+	{
+	public:
+#if defined( CH_SIMD_SSE2 )
+		Vec3f() : mV(_mm_setzero_ps()) {}
+		explicit Vec3f(__m128 v) : mV(v) {}
+		Vec3f(Real x, Real y, Real z) : mV(_mm_set_ps(0.f, z, y, x)) {}
+
+		static Vec3f Load(const Geometry::Vector3D &v)
+		{
+			const float* p = &v[0];
+			__m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast< const double* >(p)));
+			return Vec3f(_mm_movelh_ps(xy, _mm_load_ss(p + 2)));
+		}
+		void Store(Geometry::Vector3D &v) const
+		{
+			float* p = &v[0];
+			_mm_store_sd(reinterpret_cast< double* >(p), _mm_castps_pd(mV));
+			_mm_store_ss(p + 2, _mm_movehl_ps(mV, mV));
+		}
+
+		Real X(void) const	{ return _mm_cvtss_f32(mV); }
+		Real Y(void) const	{ return _mm_cvtss_f32(_mm_shuffle_ps(mV, mV, _MM_SHUFFLE(1, 1, 1, 1))); }
+		Real Z(void) const	{ return _mm_cvtss_f32(_mm_movehl_ps(mV, mV)); }
+
+		Vec3f& operator+=(const Vec3f &rhs)	{ mV = _mm_add_ps(mV, rhs.mV); return *this; }
+		Vec3f& operator-=(const Vec3f &rhs)	{ mV = _mm_sub_ps(mV, rhs.mV); return *this; }
+		Vec3f& operator*=(Real s)			{ mV = _mm_mul_ps(mV, _mm_set1_ps(s)); return *this; }
+
+		friend Vec3f operator+(const Vec3f &lhs, const Vec3f &rhs)	{ return Vec3f(_mm_add_ps(lhs.mV, rhs.mV)); }
+		friend Vec3f operator-(const Vec3f &lhs, const Vec3f &rhs)	{ return Vec3f(_mm_sub_ps(lhs.mV, rhs.mV)); }
+		friend Vec3f operator*(const Vec3f &lhs, Real s)			{ return Vec3f(_mm_mul_ps(lhs.mV, _mm_set1_ps(s))); }
+		friend Vec3f operator*(Real s, const Vec3f &rhs)			{ return Vec3f(_mm_mul_ps(_mm_set1_ps(s), rhs.mV)); }
+
+		/// ((0 + x) + y) + z, as Geometry::Dot does it.
+		friend Real Dot(const Vec3f &lhs, const Vec3f &rhs)
+		{
+			__m128 m = _mm_mul_ps(lhs.mV, rhs.mV);
+			__m128 sum = _mm_add_ss(_mm_setzero_ps(), m);
+			sum = _mm_add_ss(sum, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+			sum = _mm_add_ss(sum, _mm_movehl_ps(m, m));
+			return _mm_cvtss_f32(sum);
+		}
+		friend Vec3f Cross(const Vec3f &lhs, const Vec3f &rhs)
+		{
+			__m128 a_yzx = _mm_shuffle_ps(lhs.mV, lhs.mV, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 a_zxy = _mm_shuffle_ps(lhs.mV, lhs.mV, _MM_SHUFFLE(3, 1, 0, 2));
+			__m128 b_yzx = _mm_shuffle_ps(rhs.mV, rhs.mV, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 b_zxy = _mm_shuffle_ps(rhs.mV, rhs.mV, _MM_SHUFFLE(3, 1, 0, 2));
+			return Vec3f(_mm_sub_ps(_mm_mul_ps(a_yzx, b_zxy), _mm_mul_ps(a_zxy, b_yzx)));
+		}
+		Real Length(void) const
+		{
+			return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(Dot(*this, *this))));
+		}
+		/// Unit vector, or zero for the zero vector, as Vector3D::normal().
+		Vec3f Normal(void) const
+		{
+			Real len = Length();
+			if(!len)
+				return Vec3f();
+			return Vec3f(_mm_div_ps(mV, _mm_set1_ps(len)));
+		}
+
+	private:
+		__m128	mV;
+#else
+		Vec3f() : mX(0.f), mY(0.f), mZ(0.f) {}
+		Vec3f(Real x, Real y, Real z) : mX(x), mY(y), mZ(z) {}
+
+		static Vec3f Load(const Geometry::Vector3D &v)	{ return Vec3f(v[0], v[1], v[2]); }
+		void Store(Geometry::Vector3D &v) const			{ v[0] = mX; v[1] = mY; v[2] = mZ; }
+
+		Real X(void) const	{ return mX; }
+		Real Y(void) const	{ return mY; }
+		Real Z(void) const	{ return mZ; }
+
+		Vec3f& operator+=(const Vec3f &rhs)	{ mX += rhs.mX; mY += rhs.mY; mZ += rhs.mZ; return *this; }
+		Vec3f& operator-=(const Vec3f &rhs)	{ mX -= rhs.mX; mY -= rhs.mY; mZ -= rhs.mZ; return *this; }
+		Vec3f& operator*=(Real s)			{ mX *= s; mY *= s; mZ *= s; return *this; }
+
+		friend Vec3f operator+(const Vec3f &lhs, const Vec3f &rhs)	{ return Vec3f(lhs.mX + rhs.mX, lhs.mY + rhs.mY, lhs.mZ + rhs.mZ); }
+		friend Vec3f operator-(const Vec3f &lhs, const Vec3f &rhs)	{ return Vec3f(lhs.mX - rhs.mX, lhs.mY - rhs.mY, lhs.mZ - rhs.mZ); }
+		friend Vec3f operator*(const Vec3f &lhs, Real s)			{ return Vec3f(lhs.mX * s, lhs.mY * s, lhs.mZ * s); }
+		friend Vec3f operator*(Real s, const Vec3f &rhs)			{ return Vec3f(s * rhs.mX, s * rhs.mY, s * rhs.mZ); }
+
+		friend Real Dot(const Vec3f &lhs, const Vec3f &rhs)	{ return ((0.f + lhs.mX * rhs.mX) + lhs.mY * rhs.mY) + lhs.mZ * rhs.mZ; }
+		friend Vec3f Cross(const Vec3f &lhs, const Vec3f &rhs)
+		{
+			return Vec3f(lhs.mY * rhs.mZ - lhs.mZ * rhs.mY, lhs.mZ * rhs.mX - lhs.mX * rhs.mZ, lhs.mX * rhs.mY - lhs.mY * rhs.mX);
+		}
+		Real Length(void) const		{ return std::sqrt(Dot(*this, *this)); }
+		Vec3f Normal(void) const
+		{
+			Real len = Length();
+			if(!len)
+				return Vec3f();
+			return Vec3f(mX / len, mY / len, mZ / len);
+		}
+
+	private:
+		Real	mX, mY, mZ;
+#endif
+	};
+}
+
+#endif
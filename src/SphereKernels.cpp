@@ -0,0 +1,194 @@
+/*!
+	@file	SphereKernels.cpp
+	@date	October 17, 2026
+
+	@brief	Swept sphere-sphere test shared by the narrowphase and the tools.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <cmath>
+
+#include "SphereKernels.h"
+#include "SimdVector.h"
+#include "SimdLanes.h"
+
+using Physics::Vec3f;
+
+#if defined( CH_SIMD_SSE2 )
+using namespace Physics::Simd;
+#endif
+
+namespace Collision
+{
+	/*!
+	 @param sphere1 
+	 @param sphere2 
+	 @param time		Set to the fraction of the step where the spheres are
+						closest, when they hit.
+	 @return true if the spheres overlap at the start of the step and are
+			 still closing in on each other.
+	*//*__________________________________________________________________________*/
+	bool SweepSpheres(const SphereSweep &sphere1, const SphereSweep &sphere2, Real &time)
+	{
+		Vec3f p1 = Vec3f::Load(sphere1.mPositionT0);
+		Vec3f p2 = Vec3f::Load(sphere2.mPositionT0);
+
+		// Relative position
+		Vec3f dp = p2 - p1;
+
+		//Minimal distance squared
+		Real r = sphere1.mRadius + sphere2.mRadius;
+		//dP^2-r^2
+		Real pp = Dot(dp, dp) - r * r;
+		//(1)Only spheres that already overlap at the start of the step count
+		if(!(pp < 0))
+			return false;
+
+		// Relative velocity
+		Vec3f dv = (Vec3f::Load(sphere2.mPositionT1) - p2) - (Vec3f::Load(sphere1.mPositionT1) - p1);
+
+		//dP*dV
+		Real pv = Dot(dp, dv);
+		//(2)Check if the spheres are moving away from each other
+		if(pv >= 0)
+			return false;
+
+		//dV^2
+		Real vv = Dot(dv, dv);
+		//(3)Check if the spheres can intersect within 1 frame
+		if((pv + vv) <= 0 && (vv + 2 * pv + pp) >= 0)
+			return false;
+
+		//the time when the distance between the spheres is minimal
+		time = -pv / vv;
+		return true;
+	}
+
+	/*!
+	 @param sphere1 
+	 @param sphere2 
+	 @param time		Set to the fraction of the step where the spheres first
+						touch; 0 if they already do.
+	 @return true if the spheres touch at some point in the step while
+			 closing in on each other.
+
+	 Unlike SweepSpheres(), which waits for an overlap, this finds the first
+	 moment of contact, so fast spheres cannot pass through each other.
+	*//*__________________________________________________________________________*/
+	bool SphereTimeOfImpact(const SphereSweep &sphere1, const SphereSweep &sphere2, Real &time)
+	{
+		Vec3f p1 = Vec3f::Load(sphere1.mPositionT0);
+		Vec3f p2 = Vec3f::Load(sphere2.mPositionT0);
+		Vec3f dp = p2 - p1;
+		Vec3f dv = (Vec3f::Load(sphere2.mPositionT1) - p2) - (Vec3f::Load(sphere1.mPositionT1) - p1);
+
+		Real pv = Dot(dp, dv);
+		if(pv >= 0)
+			return false;
+
+		Real r = sphere1.mRadius + sphere2.mRadius;
+		Real pp = Dot(dp, dp) - r * r;
+		if(pp <= 0)
+		{
+			time = k0;
+			return true;
+		}
+
+		// first root of |dp + s dv|^2 = r^2
+		Real vv = Dot(dv, dv);
+		Real disc = pv * pv - vv * pp;
+		if(disc < 0)
+			return false;
+		Real s = (-pv - std::sqrt(disc)) / vv;
+		if(s > k1)
+			return false;
+		time = s;
+		return true;
+	}
+
+	/*!
+	 @param void
+
+	 Empty lanes up to the next lane width get zero radii, so they miss.
+	*//*__________________________________________________________________________*/
+	void SphereSweepBatch::Pad(void)
+	{
+#if defined( CH_SIMD_SSE2 )
+		uint32_t end = (mCount + kLaneWidth - 1) / kLaneWidth * kLaneWidth;
+		for(uint32_t lane = mCount; lane < end; ++lane)
+		{
+			for(int c = 0; c < 3; ++c)
+				mP1T0[c][lane] = mP1T1[c][lane] = mP2T0[c][lane] = mP2T1[c][lane] = 0.f;
+			mRadius1[lane] = mRadius2[lane] = 0.f;
+		}
+#endif
+	}
+
+	/*!
+	 @param void
+	 @return The number of pairs that hit.
+	*//*__________________________________________________________________________*/
+	uint32_t SphereSweepBatch::Run(void)
+	{
+#if defined( CH_SIMD_SSE2 )
+		Pad();
+		const Lane zero = Zero();
+		const Lane two = Splat(2.f);
+		const Lane sign = Splat(-0.f);
+		for(uint32_t i = 0; i < mCount; i += kLaneWidth)
+		{
+			Lane p1x = Load(&mP1T0[0][i]), p1y = Load(&mP1T0[1][i]), p1z = Load(&mP1T0[2][i]);
+			Lane p2x = Load(&mP2T0[0][i]), p2y = Load(&mP2T0[1][i]), p2z = Load(&mP2T0[2][i]);
+			Lane e1x = Load(&mP1T1[0][i]), e1y = Load(&mP1T1[1][i]), e1z = Load(&mP1T1[2][i]);
+			Lane e2x = Load(&mP2T1[0][i]), e2y = Load(&mP2T1[1][i]), e2z = Load(&mP2T1[2][i]);
+
+			// Relative position and velocity
+			Lane dpx = Sub(p2x, p1x), dpy = Sub(p2y, p1y), dpz = Sub(p2z, p1z);
+			Lane dvx = Sub(Sub(e2x, p2x), Sub(e1x, p1x));
+			Lane dvy = Sub(Sub(e2y, p2y), Sub(e1y, p1y));
+			Lane dvz = Sub(Sub(e2z, p2z), Sub(e1z, p1z));
+
+			Lane r = Add(Load(&mRadius1[i]), Load(&mRadius2[i]));
+			Lane pp = Sub(Dot(dpx, dpy, dpz, dpx, dpy, dpz), Mul(r, r));
+			Lane pv = Dot(dpx, dpy, dpz, dvx, dvy, dvz);
+			Lane vv = Dot(dvx, dvy, dvz, dvx, dvy, dvz);
+
+			// the three early-outs of SweepSpheres(), as masks
+			Lane hit = Less(pp, zero);
+			hit = AndNot(GreaterEqual(pv, zero), hit);
+			Lane apart = And(LessEqual(Add(pv, vv), zero), GreaterEqual(Add(Add(vv, Mul(two, pv)), pp), zero));
+			hit = AndNot(apart, hit);
+			StoreMask(&mHit[i], hit);
+			Store(&mTime[i], Div(Xor(pv, sign), vv));
+
+			// normal from the second sphere to the first at the end of the step; zero if they coincide
+			Lane nx = Sub(e1x, e2x), ny = Sub(e1y, e2y), nz = Sub(e1z, e2z);
+			Lane len = Sqrt(Dot(nx, ny, nz, nx, ny, nz));
+			Lane nonzero = NotEqual(len, zero);
+			Store(&mNormal[0][i], And(Div(nx, len), nonzero));
+			Store(&mNormal[1][i], And(Div(ny, len), nonzero));
+			Store(&mNormal[2][i], And(Div(nz, len), nonzero));
+		}
+#else
+		for(uint32_t i = 0; i < mCount; ++i)
+		{
+			SphereSweep sphere1, sphere2;
+			sphere1.mPositionT0 = Vector3D(mP1T0[0][i], mP1T0[1][i], mP1T0[2][i]);
+			sphere1.mPositionT1 = Vector3D(mP1T1[0][i], mP1T1[1][i], mP1T1[2][i]);
+			sphere1.mRadius = mRadius1[i];
+			sphere2.mPositionT0 = Vector3D(mP2T0[0][i], mP2T0[1][i], mP2T0[2][i]);
+			sphere2.mPositionT1 = Vector3D(mP2T1[0][i], mP2T1[1][i], mP2T1[2][i]);
+			sphere2.mRadius = mRadius2[i];
+			mHit[i] = SweepSpheres(sphere1, sphere2, mTime[i]) ? 0xFFFFFFFF : 0;
+			Vector3D normal = (sphere1.mPositionT1 - sphere2.mPositionT1).normal();
+			for(int c = 0; c < 3; ++c)
+				mNormal[c][i] = normal[c];
+		}
+#endif
+		uint32_t hits = 0;
+		for(uint32_t i = 0; i < mCount; ++i)
+			hits += mHit[i] != 0;
+		return hits;
+	}
+}
@@ -0,0 +1,109 @@
+/*!
+	@file	SphereKernels.h
+	@date	October 17, 2026
+
+	@brief	Swept sphere-sphere tests shared by the narrowphase and the tools.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SPHEREKERNELS_H__
+#define	__SPHEREKERNELS_H__
+
+#include "MathDefs.h"
+#include "Geometry.hpp"
+
+namespace Collision
+{
+	using Geometry::Vector3D;
+
+	/*!
+	 @class		SphereSweep
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Start and end of one sphere's move over a step.
+	*//*__________________________________________________________________________*/
+	struct SphereSweep
+	{
+		Vector3D	mPositionT0;
+		Vector3D	mPositionT1;
+		Real		mRadius;
+	};
+
+	bool	SweepSpheres(const SphereSweep &sphere1, const SphereSweep &sphere2, Real &time);
+	bool	SphereTimeOfImpact(const SphereSweep &sphere1, const SphereSweep &sphere2, Real &time);
+
+	/*!
+	 @class		SphereSweepBatch
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		SweepSpheres() over many pairs at once.
+
+		Pairs are pushed one at a time into structure-of-arrays lanes. Run()
+		then tests them four (SSE2) or eight (AVX) at a time, without
+		branches, and also works out the contact normal of every hit: the
+		unit vector from the second sphere's end position to the first's.
+		Each lane gives exactly the bits the single-pair SweepSpheres() and
+		Vector3D::normal() would.
+	*//*__________________________________________________________________________*/
+	class SphereSweepBatch
+	{
+	public:
+		static const uint32_t kCapacity = 64;	///< A multiple of every lane width.
+
+		SphereSweepBatch() : mCount(0) {}
+
+		void		Clear(void)					{ mCount = 0; }
+		uint32_t	Count(void) const			{ return mCount; }
+		bool		Full(void) const			{ return mCount == kCapacity; }
+
+		/*!
+		 @return The lane the pair went into.
+		*//*__________________________________________________________________________*/
+		uint32_t	Push(const Vector3D &position1T0, const Vector3D &position1T1, Real radius1,
+						const Vector3D &position2T0, const Vector3D &position2T1, Real radius2)
+		{
+			uint32_t lane = mCount++;
+			for(int c = 0; c < 3; ++c)
+			{
+				mP1T0[c][lane] = position1T0[c];
+				mP1T1[c][lane] = position1T1[c];
+				mP2T0[c][lane] = position2T0[c];
+				mP2T1[c][lane] = position2T1[c];
+			}
+			mRadius1[lane] = radius1;
+			mRadius2[lane] = radius2;
+			return lane;
+		}
+		uint32_t	Push(const SphereSweep &sphere1, const SphereSweep &sphere2)
+		{
+			return Push(sphere1.mPositionT0, sphere1.mPositionT1, sphere1.mRadius, sphere2.mPositionT0, sphere2.mPositionT1, sphere2.mRadius);
+		}
+
+		uint32_t	Run(void);
+
+		bool		Hit(uint32_t lane) const	{ return mHit[lane] != 0; }
+		/// Only meaningful for a lane that hit.
+		Real		Time(uint32_t lane) const	{ return mTime[lane]; }
+		/// Only meaningful for a lane that hit.
+		Vector3D	Normal(uint32_t lane) const	{ return Vector3D(mNormal[0][lane], mNormal[1][lane], mNormal[2][lane]); }
+
+	private:
+		void		Pad(void);
+
+		Real		mP1T0[3][kCapacity];
+		Real		mP1T1[3][kCapacity];
+		Real		mP2T0[3][kCapacity];
+		Real		mP2T1[3][kCapacity];
+		Real		mRadius1[kCapacity];
+		Real		mRadius2[kCapacity];
+		Real		mTime[kCapacity];
+		Real		mNormal[3][kCapacity];
+		uint32_t	mHit[kCapacity];
+		uint32_t	mCount;
+	};
+}
+
+#endif
@@ -0,0 +1,352 @@
+/*!
+	@file	SpringStore.cpp
+	@date	October 17, 2026
+
+	@brief	Contiguous storage for the springs between rigid bodies.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <cmath>
+
+#include "SpringStore.h"
+#include "SimdLanes.h"
+#include "RigidBody.h"
+
+namespace Physics
+{
+const uint32_t SpringStore::kNoIndex;
+
+/*!
+ @return
+*//*__________________________________________________________________________*/
+SpringStore::SpringStore() : mBound(0), mBoundRevision(0), mDirty(true)
+{
+}
+
+/*!
+ @param handle	Names the spring at the new last dense index.
+
+ Appends a spring with the default settings: unit stiffness, damping and
+ rest length, compressible, attached at both centres, and no bodies.
+*//*__________________________________________________________________________*/
+void SpringStore::Push(uint32_t handle)
+{
+	mHandles.push_back(handle);
+	mBody1.push_back(BodyStore::kInvalid);
+	mBody2.push_back(BodyStore::kInvalid);
+	mIndex1.push_back(kNoIndex);
+	mIndex2.push_back(kNoIndex);
+	mStiffness.push_back(k1);
+	mDamping.push_back(k1);
+	mRestLength.push_back(k1);
+	mPrevLength.push_back(k1);
+	mPos1.push_back(Vector3D());
+	mPos2.push_back(Vector3D());
+	mFlags.push_back(kF_Compressible | kF_CenterAttach1 | kF_CenterAttach2);
+}
+
+/*!
+ @param void
+ @return The handle of a new spring with default settings and no bodies.
+*//*__________________________________________________________________________*/
+uint32_t SpringStore::Create(void)
+{
+	uint32_t slot;
+	if(!mFreeSlots.empty())
+	{
+		slot = mFreeSlots.back();
+		mFreeSlots.pop_back();
+	}
+	else
+	{
+		slot = (uint32_t)mSlotGeneration.size();
+		mSlotGeneration.push_back(0);
+		mSlotIndex.push_back(kNoIndex);
+	}
+	// generations start at 1 so that no live handle is ever 0
+	uint32_t gen = (mSlotGeneration[slot] + 1) & (0xFFFFFFFF >> BodyStore::kIndexBits);
+	if(gen == 0)
+		gen = 1;
+	mSlotGeneration[slot] = gen;
+
+	uint32_t handle = slot | (gen << BodyStore::kIndexBits);
+	mSlotIndex[slot] = Count();
+	Push(handle);
+	return handle;
+}
+
+/*!
+ @param handle
+ @return True if the handle named a live spring, which is now destroyed.
+
+ The last spring takes the destroyed one's dense index.
+*//*__________________________________________________________________________*/
+bool SpringStore::Destroy(uint32_t handle)
+{
+	uint32_t index = Find(handle);
+	if(index == kNoIndex)
+		return false;
+
+	uint32_t last = Count() - 1;
+	if(index != last)
+		mSlotIndex[mHandles[last] & BodyStore::kIndexMask] = index;
+	MoveLast(mHandles, index);
+	MoveLast(mBody1, index);
+	MoveLast(mBody2, index);
+	MoveLast(mIndex1, index);
+	MoveLast(mIndex2, index);
+	MoveLast(mStiffness, index);
+	MoveLast(mDamping, index);
+	MoveLast(mRestLength, index);
+	MoveLast(mPrevLength, index);
+	MoveLast(mPos1, index);
+	MoveLast(mPos2, index);
+	MoveLast(mFlags, index);
+
+	uint32_t slot = handle & BodyStore::kIndexMask;
+	mSlotIndex[slot] = kNoIndex;
+	mFreeSlots.push_back(slot);
+	return true;
+}
+
+/*!
+ @param body	Handle of a body about to be destroyed.
+ @return How many springs were attached to it, all now destroyed.
+*//*__________________________________________________________________________*/
+uint32_t SpringStore::DestroyAttached(uint32_t body)
+{
+	uint32_t removed = 0;
+	// from the back, so each spring moved into a hole has already been looked at
+	for(uint32_t i = Count(); i-- > 0; )
+	{
+		if(mBody1[i] == body || mBody2[i] == body)
+		{
+			Destroy(mHandles[i]);
+			++removed;
+		}
+	}
+	return removed;
+}
+
+/*!
+ @param void
+*//*__________________________________________________________________________*/
+void SpringStore::Clear(void)
+{
+	for(uint32_t i = 0; i < Count(); ++i)
+	{
+		uint32_t slot = mHandles[i] & BodyStore::kIndexMask;
+		mSlotIndex[slot] = kNoIndex;
+		mFreeSlots.push_back(slot);
+	}
+	mHandles.clear();
+	mBody1.clear();
+	mBody2.clear();
+	mIndex1.clear();
+	mIndex2.clear();
+	mStiffness.clear();
+	mDamping.clear();
+	mRestLength.clear();
+	mPrevLength.clear();
+	mPos1.clear();
+	mPos2.clear();
+	mFlags.clear();
+	mDirty = true;
+}
+
+/*!
+ @param src	The store to copy.
+
+ Same springs under the same handles, in the same dense order. The body
+ indices are looked up again on the next Bind(), against whichever body
+ store they are bound to then.
+*//*__________________________________________________________________________*/
+void SpringStore::CopyFrom(const SpringStore &src)
+{
+	if(&src == this)
+		return;
+
+	mHandles		= src.mHandles;
+	mSlotGeneration	= src.mSlotGeneration;
+	mSlotIndex		= src.mSlotIndex;
+	mFreeSlots		= src.mFreeSlots;
+	mBody1			= src.mBody1;
+	mBody2			= src.mBody2;
+	mIndex1			= src.mIndex1;
+	mIndex2			= src.mIndex2;
+	mStiffness		= src.mStiffness;
+	mDamping		= src.mDamping;
+	mRestLength		= src.mRestLength;
+	mPrevLength		= src.mPrevLength;
+	mPos1			= src.mPos1;
+	mPos2			= src.mPos2;
+	mFlags			= src.mFlags;
+	mBound			= 0;
+	mDirty			= true;
+}
+
+/*!
+ @param handles	Handles the springs are to have, in dense order.
+
+ Makes the store hold springs under exactly these handles, with default
+ settings, for a snapshot to fill in. If it already does, nothing
+ changes; the caller sets every attribute either way.
+*//*__________________________________________________________________________*/
+void SpringStore::Rebuild(const std::vector< uint32_t > &handles)
+{
+	if(handles == mHandles)
+		return;
+
+	Clear();
+	for(size_t i = 0; i < handles.size(); ++i)
+	{
+		uint32_t slot = handles[i] & BodyStore::kIndexMask;
+		while(slot >= mSlotGeneration.size())
+		{
+			mSlotGeneration.push_back(0);
+			mSlotIndex.push_back(kNoIndex);
+		}
+		mSlotGeneration[slot]	= handles[i] >> BodyStore::kIndexBits;
+		mSlotIndex[slot]		= Count();
+		Push(handles[i]);
+	}
+	mFreeSlots.clear();
+	for(uint32_t slot = (uint32_t)mSlotIndex.size(); slot-- > 0; )
+	{
+		if(mSlotIndex[slot] == kNoIndex)
+			mFreeSlots.push_back(slot);
+	}
+}
+
+/*!
+ @param index	Dense index of the spring.
+ @param body1	Body handles; either may be BodyStore::kInvalid.
+ @param body2
+*//*__________________________________________________________________________*/
+void SpringStore::SetBodies(uint32_t index, uint32_t body1, uint32_t body2)
+{
+	mBody1[index]	= body1;
+	mBody2[index]	= body2;
+	mDirty			= true;
+}
+
+/*!
+ @param bodies	The store the springs' body handles live in.
+
+ Looks up the dense index of every spring's bodies, if springs or bodies
+ have changed since the last time; otherwise does nothing.
+*//*__________________________________________________________________________*/
+void SpringStore::Bind(const BodyStore &bodies)
+{
+	if(!mDirty && mBound == &bodies && mBoundRevision == bodies.Revision())
+		return;
+
+	for(uint32_t i = 0; i < Count(); ++i)
+	{
+		RigidBody* body1 = bodies.Lookup(mBody1[i]);
+		RigidBody* body2 = bodies.Lookup(mBody2[i]);
+		mIndex1[i] = body1 ? body1->Index() : kNoIndex;
+		mIndex2[i] = body2 ? body2->Index() : kNoIndex;
+	}
+	mBound			= &bodies;
+	mBoundRevision	= bodies.Revision();
+	mDirty			= false;
+}
+
+/*!
+ @param bodies	Receives the spring forces in mForce.
+
+ Pulls (or, for compressible springs, pushes) each pair of bodies
+ together by stiffness times the stretch, plus damping times the change
+ since the last step, along the line between their centres. Springs
+ missing a body are skipped.
+*//*__________________________________________________________________________*/
+void SpringStore::ApplyForces(BodyStore &bodies)
+{
+	Bind(bodies);
+	const uint32_t count = Count();
+	if(count == 0)
+		return;
+
+	for(int c = 0; c < 3; ++c)
+		mDir[c].resize(count);
+	mForce.resize(count);
+	mLength.resize(count);
+	mActive.resize(count);
+
+	// gather the lines between the bodies
+	for(uint32_t i = 0; i < count; ++i)
+	{
+		uint32_t i1 = mIndex1[i], i2 = mIndex2[i];
+		if(i1 == kNoIndex || i2 == kNoIndex)
+		{
+			mDir[0][i] = mDir[1][i] = mDir[2][i] = k0;
+			mActive[i] = 0;
+			continue;
+		}
+		const Vector3D &p1 = bodies.mPositionT1[i1];
+		const Vector3D &p2 = bodies.mPositionT1[i2];
+		mDir[0][i]	= p1[0] - p2[0];
+		mDir[1][i]	= p1[1] - p2[1];
+		mDir[2][i]	= p1[2] - p2[2];
+		mActive[i]	= 0xFFFFFFFF;
+	}
+
+	uint32_t i = 0;
+#if defined( CH_SIMD_SSE2 )
+	// whole lanes; the float steps match the scalar tail's one for one
+	using namespace Simd;
+	const Lane zero = Zero();
+	for(; i + kLaneWidth <= count; i += kLaneWidth)
+	{
+		Lane dx = Load(&mDir[0][i]), dy = Load(&mDir[1][i]), dz = Load(&mDir[2][i]);
+		Lane length = Sqrt(Dot(dx, dy, dz, dx, dy, dz));
+		Lane x		= Sub(length, Load(&mRestLength[i]));
+		Lane prev	= Load(&mPrevLength[i]);
+		Lane force	= Mul(Load(&mStiffness[i]), x);
+		force		= Add(force, Mul(Sub(prev, x), Load(&mDamping[i])));
+
+		// compressible, or stretched, and bound to two bodies
+		Real compressible[kLaneWidth];
+		for(uint32_t k = 0; k < kLaneWidth; ++k)
+			compressible[k] = (mFlags[i + k] & kF_Compressible) ? k1 : k0;
+		Lane bound	= Load(reinterpret_cast< const Real* >(&mActive[i]));
+		Lane mask	= And(bound, Or(NotEqual(Load(compressible), zero), Less(zero, x)));
+
+		Store(&mPrevLength[i], Or(And(mask, length), AndNot(mask, prev)));
+		Store(&mForce[i], force);
+		StoreMask(&mActive[i], mask);
+	}
+#endif
+	for(; i < count; ++i)
+	{
+		if(!mActive[i])
+			continue;
+		Real dx = mDir[0][i], dy = mDir[1][i], dz = mDir[2][i];
+		Real length = std::sqrt(((k0 + dx * dx) + dy * dy) + dz * dz);
+		Real x = length - mRestLength[i];
+		if((mFlags[i] & kF_Compressible) || (x > k0))
+		{
+			Real force = mStiffness[i] * x;
+			Real v = mPrevLength[i] - x;
+			force += v * mDamping[i];
+			mPrevLength[i] = length;
+			mForce[i] = force;
+		}
+		else
+			mActive[i] = 0;
+	}
+
+	// scatter in dense order, since two springs may share a body
+	for(i = 0; i < count; ++i)
+	{
+		if(!mActive[i])
+			continue;
+		Real force = mForce[i];
+		Vector3D dir(mDir[0][i], mDir[1][i], mDir[2][i]);
+		bodies.mForce[mIndex1[i]] += -force * dir;
+		bodies.mForce[mIndex2[i]] += force * dir;
+	}
+}
+}
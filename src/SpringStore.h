@@ -0,0 +1,130 @@
+/*!
+	@file	SpringStore.h
+	@date	October 17, 2026
+
+	@brief	Contiguous storage for the springs between rigid bodies.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__SPRINGSTORE_H__
+#define	__SPRINGSTORE_H__
+
+#include <vector>
+
+#include "BodyStore.h"
+
+namespace Physics
+{
+	/*!
+	 @class		SpringStore
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Structure-of-arrays storage for every spring in an engine.
+
+		Springs are named by handles built the same way as the body store's,
+		and each attribute lives in its own aligned array by dense index. A
+		spring holds the handles of its two bodies; their dense indices are
+		looked up again only when bodies have come or gone since the last
+		step.
+
+		Removal moves the last spring into the hole, so it costs the same
+		however many springs there are; dense order, which is the order the
+		forces are added to the bodies, is therefore creation order only
+		until the first removal. Snapshots and CopyFrom() keep it.
+
+		ApplyForces() works out the springs' forces in lanes of four or
+		eight (see SimdLanes.h) with the same float steps as its scalar
+		tail, then adds them to the bodies one spring at a time in dense
+		order, so the result does not depend on the lane width.
+	*//*__________________________________________________________________________*/
+	class SpringStore
+	{
+	public:
+		/// Spring flags, one byte per spring in mFlags.
+		enum eSpringFlag
+		{
+			kF_Compressible		= 1 << 0,	///< Pushes back when shorter than its rest length, too.
+			kF_CenterAttach1	= 1 << 1,	///< Attached at the centre of the first body.
+			kF_CenterAttach2	= 1 << 2
+		};
+
+		static const uint32_t kNoIndex = 0xFFFFFFFF;
+
+		SpringStore();
+		~SpringStore() {}
+
+		uint32_t	Create(void);
+		bool		Destroy(uint32_t handle);
+		uint32_t	DestroyAttached(uint32_t body);
+		void		Clear(void);
+		void		CopyFrom(const SpringStore &src);
+		void		Rebuild(const std::vector< uint32_t > &handles);
+
+		/*!
+		 @param handle
+		 @return The spring's dense index, or kNoIndex if the handle is stale.
+		*//*__________________________________________________________________________*/
+		uint32_t	Find(uint32_t handle) const
+		{
+			uint32_t slot = handle & BodyStore::kIndexMask;
+			if(slot >= mSlotGeneration.size() || mSlotGeneration[slot] != (handle >> BodyStore::kIndexBits))
+				return kNoIndex;
+			return mSlotIndex[slot];
+		}
+		uint32_t	Count(void) const				{ return (uint32_t)mHandles.size(); }
+		uint32_t	Handle(uint32_t index) const	{ return mHandles[index]; }
+		bool		Flag(uint32_t index, uint8_t bit) const	{ return (mFlags[index] & bit) != 0; }
+		void		Flag(uint32_t index, uint8_t bit, bool val)
+		{
+			if(val)
+				mFlags[index] |= bit;
+			else
+				mFlags[index] &= ~bit;
+		}
+
+		void		SetBodies(uint32_t index, uint32_t body1, uint32_t body2);
+		void		Bind(const BodyStore &bodies);
+		void		ApplyForces(BodyStore &bodies);
+
+	public:
+		BodyStore::Array< uint32_t >::Type	mBody1, mBody2;		///< Handles of the bodies, or BodyStore::kInvalid; see SetBodies().
+		BodyStore::Array< uint32_t >::Type	mIndex1, mIndex2;	///< Their dense indices, or kNoIndex; see Bind().
+		BodyStore::Array< Real >::Type		mStiffness;
+		BodyStore::Array< Real >::Type		mDamping;
+		BodyStore::Array< Real >::Type		mRestLength;
+		BodyStore::Array< Real >::Type		mPrevLength;		///< Length at the last step, for the damping.
+		BodyStore::Array< Vector3D >::Type	mPos1, mPos2;		///< Attach points; not used by the force yet.
+		BodyStore::Array< uint8_t >::Type	mFlags;
+
+	private:
+		// disabled
+		SpringStore(const SpringStore &);
+		SpringStore& operator=(const SpringStore &);
+
+		template< typename T_ > static void MoveLast(T_ &array, uint32_t index)
+		{
+			array[index] = array.back();
+			array.pop_back();
+		}
+		void		Push(uint32_t handle);
+
+		std::vector< uint32_t >		mHandles;			///< Dense index to handle.
+		std::vector< uint32_t >		mSlotGeneration;	///< Current generation of each slot.
+		std::vector< uint32_t >		mSlotIndex;			///< Dense index of each slot, or kNoIndex.
+		std::vector< uint32_t >		mFreeSlots;
+		const BodyStore*			mBound;				///< Store the indices were looked up in...
+		uint32_t					mBoundRevision;		///< ...at this revision of it.
+		bool						mDirty;				///< A spring was added or given a new body since.
+
+		// scratch for ApplyForces(), one lane-padded array per component
+		BodyStore::Array< Real >::Type	mDir[3];
+		BodyStore::Array< Real >::Type	mForce;
+		BodyStore::Array< Real >::Type	mLength;
+		BodyStore::Array< uint32_t >::Type	mActive;
+	};
+}
+
+#endif
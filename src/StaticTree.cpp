@@ -0,0 +1,178 @@
+/*!
+	@file	StaticTree.cpp
+	@date	October 17, 2026
+
+	@brief	Bounding volume hierarchy over the fixed collision geometry.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+
+#include "StaticTree.h"
+#include "RigidBody.h"
+
+using Physics::BodyStore;
+
+namespace Collision
+{
+	/// Most bodies a leaf node holds before it is split.
+	static const uint32_t kLeafSize = 2;
+
+	/// Orders leaves on one axis of their centers, body index breaking ties.
+	struct StaticTree::LeafLess
+	{
+		explicit LeafLess(int axis) : mAxis(axis) {}
+		bool operator()(const Leaf &lhs, const Leaf &rhs) const
+		{
+			if(lhs.mCenter[mAxis] != rhs.mCenter[mAxis])
+				return lhs.mCenter[mAxis] < rhs.mCenter[mAxis];
+			return lhs.mBody < rhs.mBody;
+		}
+		int mAxis;
+	};
+
+/*!
+ @param bodies
+ @param body	Dense index.
+ @return True if the body's shape has a finite box the tree can hold.
+*//*__________________________________________________________________________*/
+bool StaticTree::Bounded(BodyStore &bodies, uint32_t body)
+{
+	Physics::GeometryType* geom = bodies.Body(body)->mCollideGeom;
+	return geom && geom->Kind() != Physics::kC_Plane && geom->Kind() != Physics::kC_Sphere;
+}
+
+/*!
+ @param bodies
+ @param members	Dense indices of fixed bodies with Bounded() shapes.
+
+ Triangles are boxed by their corners, boxes by their extents, and the
+ other shapes by their bounding radius about the body's position.
+*//*__________________________________________________________________________*/
+void StaticTree::Build(BodyStore &bodies, const std::vector< uint32_t > &members)
+{
+	mNodes.clear();
+	mLeaves.resize(members.size());
+	for(size_t i = 0; i < members.size(); ++i)
+	{
+		Leaf &leaf = mLeaves[i];
+		leaf.mBody = members[i];
+		Physics::GeometryType* geom = bodies.Body(members[i])->mCollideGeom;
+		const Vector3D &pos = bodies.mPositionT1[members[i]];
+		for(int axis = 0; axis < 3; ++axis)
+		{
+			if(geom->Kind() == Physics::kC_BoundedPlane)
+			{
+				const Geometry::Triangle3D &tri = ((Physics::BoundedPlane*)geom)->mPolygon;
+				leaf.mLo[axis] = (Real)std::min(std::min(tri[0][axis], tri[1][axis]), tri[2][axis]);
+				leaf.mHi[axis] = (Real)std::max(std::max(tri[0][axis], tri[1][axis]), tri[2][axis]);
+			}
+			else
+			{
+				Real reach = geom->Kind() == Physics::kC_Box ? (Real)((Physics::Box*)geom)->mHalfExtents[axis] : geom->Bound();
+				leaf.mLo[axis] = (Real)pos[axis] - reach;
+				leaf.mHi[axis] = (Real)pos[axis] + reach;
+			}
+			leaf.mCenter[axis] = .5f * (leaf.mLo[axis] + leaf.mHi[axis]);
+		}
+	}
+	if(!mLeaves.empty())
+		Split(0, (uint32_t)mLeaves.size());
+
+	mBodies.resize(mLeaves.size());
+	for(size_t i = 0; i < mLeaves.size(); ++i)
+		mBodies[i] = mLeaves[i].mBody;
+}
+
+/*!
+ @param first	First leaf of the range.
+ @param count	Leaves in the range.
+ @return The node made for the range.
+
+ Splits at the median of the centers along the range's longest side.
+*//*__________________________________________________________________________*/
+uint32_t StaticTree::Split(uint32_t first, uint32_t count)
+{
+	uint32_t index = (uint32_t)mNodes.size();
+	mNodes.push_back(Node());
+	Node node;
+	node.mFirst	= first;
+	node.mCount	= count;
+	node.mRight	= 0;
+	Real lo[3], hi[3];
+	for(int axis = 0; axis < 3; ++axis)
+	{
+		node.mLo[axis] = lo[axis] = kMax;
+		node.mHi[axis] = hi[axis] = -kMax;
+	}
+	for(uint32_t i = first; i < first + count; ++i)
+	{
+		const Leaf &leaf = mLeaves[i];
+		for(int axis = 0; axis < 3; ++axis)
+		{
+			node.mLo[axis] = std::min(node.mLo[axis], leaf.mLo[axis]);
+			node.mHi[axis] = std::max(node.mHi[axis], leaf.mHi[axis]);
+			lo[axis] = std::min(lo[axis], leaf.mCenter[axis]);
+			hi[axis] = std::max(hi[axis], leaf.mCenter[axis]);
+		}
+	}
+
+	if(count > kLeafSize)
+	{
+		int axis = 0;
+		for(int a = 1; a < 3; ++a)
+			if(hi[a] - lo[a] > hi[axis] - lo[axis])
+				axis = a;
+		uint32_t half = count / 2;
+		std::nth_element(mLeaves.begin() + first, mLeaves.begin() + first + half, mLeaves.begin() + first + count, LeafLess(axis));
+		Split(first, half);
+		node.mRight = Split(first + half, count - half);
+		node.mCount = 0;
+	}
+	mNodes[index] = node;
+	return index;
+}
+
+/*!
+ @param lo		Low corner of the box to test.
+ @param hi		High corner.
+ @param hits	The dense index of every body whose box touches it is appended.
+*//*__________________________________________________________________________*/
+void StaticTree::Query(const Vector3D &lo, const Vector3D &hi, std::vector< uint32_t > &hits)
+{
+	if(mNodes.empty())
+		return;
+	Real qLo[3] = { (Real)lo[0], (Real)lo[1], (Real)lo[2] };
+	Real qHi[3] = { (Real)hi[0], (Real)hi[1], (Real)hi[2] };
+
+	mStack.clear();
+	mStack.push_back(0);
+	while(!mStack.empty())
+	{
+		const Node &node = mNodes[mStack.back()];
+		uint32_t index = mStack.back();
+		mStack.pop_back();
+		if(qHi[0] < node.mLo[0] || qLo[0] > node.mHi[0]
+			|| qHi[1] < node.mLo[1] || qLo[1] > node.mHi[1]
+			|| qHi[2] < node.mLo[2] || qLo[2] > node.mHi[2])
+			continue;
+		if(node.mCount == 0)
+		{
+			mStack.push_back(node.mRight);
+			mStack.push_back(index + 1);
+			continue;
+		}
+		for(uint32_t i = node.mFirst; i < node.mFirst + node.mCount; ++i)
+		{
+			const Leaf &leaf = mLeaves[i];
+			if(qHi[0] < leaf.mLo[0] || qLo[0] > leaf.mHi[0]
+				|| qHi[1] < leaf.mLo[1] || qLo[1] > leaf.mHi[1]
+				|| qHi[2] < leaf.mLo[2] || qLo[2] > leaf.mHi[2])
+				continue;
+			hits.push_back(leaf.mBody);
+		}
+	}
+}
+
+}
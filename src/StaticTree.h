@@ -0,0 +1,74 @@
+/*!
+	@file	StaticTree.h
+	@date	October 17, 2026
+
+	@brief	Bounding volume hierarchy over the fixed collision geometry.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__STATICTREE_H__
+#define	__STATICTREE_H__
+
+#include <vector>
+
+#include "PhysicsDefs.h"
+#include "BodyStore.h"
+
+namespace Collision
+{
+	/*!
+	 @class		StaticTree
+	 @ingroup	Physics Engine Proto
+	 @date		10-17-2026
+	 @brief		Axis-aligned box tree over bodies that do not move.
+
+		Built once from the pocket triangles and other bounded shapes, then
+		asked, for each moving sphere, which of them its swept box touches,
+		so the cost per sphere grows with the depth of the tree rather than
+		with the number of facets. A leaf's box is exactly the box the old
+		per-pair bounds test used, so the tree reports the same bodies.
+		Infinite planes have no box and stay out of the tree.
+	*//*__________________________________________________________________________*/
+	class StaticTree
+	{
+	public:
+		StaticTree() {}
+		~StaticTree() {}
+
+		static bool	Bounded(Physics::BodyStore &bodies, uint32_t body);
+
+		void		Build(Physics::BodyStore &bodies, const std::vector< uint32_t > &members);
+		void		Query(const Vector3D &lo, const Vector3D &hi, std::vector< uint32_t > &hits);
+		bool		Empty(void) const		{ return mNodes.empty(); }
+		/// The bodies in the tree, by dense index, in leaf order.
+		const std::vector< uint32_t >&	Members(void) const	{ return mBodies; }
+
+	private:
+		/// A node's box covers its mCount bodies from mFirst; inner nodes keep their right child at mRight.
+		struct Node
+		{
+			Real		mLo[3], mHi[3];
+			uint32_t	mFirst, mCount;
+			uint32_t	mRight;
+		};
+		struct Leaf
+		{
+			Real		mLo[3], mHi[3];
+			Real		mCenter[3];
+			uint32_t	mBody;
+		};
+		struct LeafLess;
+
+		uint32_t	Split(uint32_t first, uint32_t count);
+
+		std::vector< Node >		mNodes;			///< Root first; a left child follows its parent.
+		std::vector< Leaf >		mLeaves;
+		std::vector< uint32_t >	mBodies;
+		std::vector< uint32_t >	mStack;			///< Nodes still to visit; kept to save allocations.
+	};
+}
+
+#endif
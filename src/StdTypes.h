@@ -1,37 +1,43 @@
-#if !defined( STDTYPES_H_ )
-#define STDTYPES_H_
-////////////////////////////////////////////////////////////////////////////////
-/**
-@file       StdTypes.h
-@brief      CS300 Advanced Computer Graphics (I)
-
-            This file contains geometric data structures and function
-            prototypes used in geometrical calculus, such as vector, line,
-            plane, etc.
-
-@author     
-@date       Started:    January     07, 2004 15:38
-@date       Modified:   February    06, 2004 18:40
-@note       Instructor: Xin Li
-@note       Copyright  2004 DigiPen Institute of Technology
-*/
-////////////////////////////////////////////////////////////////////////////////
-
-/// Synonym for signed char.
-typedef signed char                     int8_t;
-/// Synonym for signed short.
-typedef signed short                    int16_t;
-/// Synonym for signed long.
-typedef signed long                     int32_t;
-/// Synonym for unsigned char.
-typedef unsigned char                   uint8_t;
-/// Synonym for unsigned short.
-typedef unsigned short                  uint16_t;
-/// Synonym for unsigned long.
-typedef unsigned long                   uint32_t;
-/// Synonym for float.
-typedef float                           f32_t;
-/// Synonym for double.
-typedef float                          f64_t; 
-
-#endif // #if !defined( STDTYPES_H_ )
+#if !defined( STDTYPES_H_ )
+#define STDTYPES_H_
+////////////////////////////////////////////////////////////////////////////////
+/**
+@file       StdTypes.h
+@brief      CS300 Advanced Computer Graphics (I)
+
+            This file contains geometric data structures and function
+            prototypes used in geometrical calculus, such as vector, line,
+            plane, etc.
+
+@author     
+@date       Started:    January     07, 2004 15:38
+@date       Modified:   February    06, 2004 18:40
+@note       Instructor: Xin Li
+@note       Copyright  2004 DigiPen Institute of Technology
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( _MSC_VER )
+/// Synonym for signed char.
+typedef signed char                     int8_t;
+/// Synonym for signed short.
+typedef signed short                    int16_t;
+/// Synonym for signed long.
+typedef signed long                     int32_t;
+/// Synonym for unsigned char.
+typedef unsigned char                   uint8_t;
+/// Synonym for unsigned short.
+typedef unsigned short                  uint16_t;
+/// Synonym for unsigned long.
+typedef unsigned long                   uint32_t;
+#else
+// Other compilers ship the C99 fixed-width types; redefining them conflicts.
+#include <stdint.h>
+#endif
+
+/// Synonym for float.
+typedef float                           f32_t;
+/// Synonym for double.
+typedef float                          f64_t; 
+
+#endif // #if !defined( STDTYPES_H_ )
@@ -1,34 +1,34 @@
-/*! =========================================================================
-      
-      @file    nsl.h
-      @brief   Ninja Standard Library header.
-      
-    ========================================================================= 
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- 
- (c) 2004 DigiPen (USA) Corporation, all rights reserved.
- */
-
-/*                                                                      guard
------------------------------------------------------------------------------ */
-
-#ifndef _NINJA_STANDARD_LIBRARY_H_
-#define _NINJA_STANDARD_LIBRARY_H_
-
-
-/*                                                                   includes
------------------------------------------------------------------------------ */
-
-#include "nsl_common.h"
-
-#include "nsl_exception.h"
-
-#include "nsl_bstream.h"
-#include "nsl_singleton.h"
-
-#include "nsl_tools_file.h"
-#include "nsl_tools_math.h"
-#include "nsl_tools_string.h"
-
-
-#endif  /* _NINJA_STANDARD_LIBRARY_H_ */
+/*! =========================================================================
+      
+      @file    nsl.h
+      @brief   Ninja Standard Library header.
+      
+    ========================================================================= 
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ 
+ (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+ */
+
+/*                                                                      guard
+----------------------------------------------------------------------------- */
+
+#ifndef _NINJA_STANDARD_LIBRARY_H_
+#define _NINJA_STANDARD_LIBRARY_H_
+
+
+/*                                                                   includes
+----------------------------------------------------------------------------- */
+
+#include "nsl_common.h"
+
+#include "nsl_exception.h"
+
+#include "nsl_bstream.h"
+#include "nsl_singleton.h"
+
+#include "nsl_tools_file.h"
+#include "nsl_tools_math.h"
+#include "nsl_tools_string.h"
+
+
+#endif  /* _NINJA_STANDARD_LIBRARY_H_ */
@@ -1,10 +1,10 @@
-/*! =========================================================================
-      
-      @file    nsl_singleton.cpp
-      @brief   nsl::singleton implementation.
-      
-      (c) 2004 DigiPen (USA) Corporation, all rights reserved.
-      
-    ========================================================================= */
-
+/*! =========================================================================
+      
+      @file    nsl_singleton.cpp
+      @brief   nsl::singleton implementation.
+      
+      (c) 2004 DigiPen (USA) Corporation, all rights reserved.
+      
+    ========================================================================= */
+
 #include "main.h"
\ No newline at end of file
@@ -0,0 +1,264 @@
+/*!
+	@file	AiBench.cpp
+	@date	October 17, 2026
+
+	@brief	Times AIPlayer's shot selection on full 18- and 19-ball tables.
+
+		Usage: aibench [--net file] [--reps n]
+
+		Racks each table the way Playfield::RackBalls does and times
+		choosing a shot from it, both racked and after a break has come to
+		rest: once with the loop SelectShot used to run, which works out
+		the ghost ball, aim and features again for every legal ball, pocket
+		and other ball, and once with AI::ShotPlanner, which works them out
+		once per ball and pocket, tests every path against all the balls in
+		lanes and scores the table in one batch. Both read the positions
+		from the engine as SelectShot does. The median over --reps (default
+		200) is reported, and whether both found the same best score.
+
+		--net (default data/AIPlayer.bpn) is the net to score with.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Physics.h"
+#include "ShotPlanner.h"
+#include "TableSetup.h"
+
+using Physics::Engine;
+using namespace TableSetup;
+
+namespace
+{
+	double Micros(Clock::time_point t0, Clock::time_point t1)
+	{
+		return std::chrono::duration< double, std::micro >(t1 - t0).count();
+	}
+
+	double Median(std::vector< double > s)
+	{
+		std::sort(s.begin(), s.end());
+		size_t n = s.size();
+		return n % 2 ? s[n / 2] : .5 * (s[n / 2 - 1] + s[n / 2]);
+	}
+
+	/// A table: the engine, the cue ball, the object balls and the pockets.
+	struct Table
+	{
+		explicit Table() : mEngine(Physics::Params()), mCue(0) {}
+		Engine					mEngine;
+		uint32_t				mCue;
+		std::vector< uint32_t >	mBalls;
+		Pockets					mPockets;
+	};
+
+	/*!
+	 @param t
+	 @param kind	18 or 19.
+	 @param breakShot	Strike the cue ball down the table and let it come to rest.
+	*//*__________________________________________________________________________*/
+	void Rack(Table &t, int kind, bool breakShot)
+	{
+		AddTable(t.mEngine, &t.mPockets);
+		std::vector< Vector3D > pos;
+		if(kind == 18)
+			Rack18(pos);
+		else
+			Rack19(pos);
+		t.mCue = AddBall(t.mEngine, Vector3D(0, 0, -25));
+		for(size_t i = 0; i < pos.size(); ++i)
+			t.mBalls.push_back(AddBall(t.mEngine, pos[i]));
+
+		if(breakShot)
+		{
+			t.mEngine.Disturb();
+			t.mEngine.RigidBodyVector3D(t.mCue, Engine::propVeloctity, Vector3D(.05f, .02f, 1.f) * 60.f);
+			for(int frames = 0; !t.mEngine.AtRest() && frames < kMaxFrames; ++frames)
+				t.mEngine.Update(kFrameTime, kSubsteps);
+		}
+	}
+
+	/// The shot a selection settled on.
+	struct Choice
+	{
+		Geometry::Vector3D	mAim;			///< Normalized.
+		float				mScore;
+		uint32_t			mCandidates;
+	};
+
+	struct LegacyShot
+	{
+		Geometry::Vector3D	mAim;
+		Geometry::Point3D	mGhost;
+		float				mScore;
+		bool operator<(const LegacyShot &rhs) const	{ return mScore < rhs.mScore; }
+	};
+
+	Geometry::Point3D Position(Engine &e, uint32_t id)
+	{
+		Vector3D p = e.RigidBodyVector3D(id, Engine::propPosition);
+		return Geometry::Point3D(p[0], p[1], p[2]);
+	}
+
+	/// GetBallByNumber() as it was: copies the ball list to find one ball.
+	uint32_t BallByNumber(const std::vector< uint32_t > &balls, uint32_t number)
+	{
+		std::vector< uint32_t > copy = balls;
+		return copy[number];
+	}
+
+	/*!
+	 @brief	SelectShot's loop before ShotPlanner: everything once per legal
+			ball, pocket and other ball, and a row for the net each time.
+	*//*__________________________________________________________________________*/
+	Choice Legacy(Table &t, AI::NeuralNet &net, std::vector< float > &inputs, std::vector< float > &scores)
+	{
+		std::vector< uint32_t > numbered(1, t.mCue);
+		numbered.insert(numbered.end(), t.mBalls.begin(), t.mBalls.end());
+
+		std::vector< LegacyShot > shots;
+		inputs.clear();
+		Geometry::Point3D cue = Position(t.mEngine, BallByNumber(numbered, 0));
+		for(uint32_t i = 1; i < numbered.size(); ++i)
+		{
+			Geometry::Point3D center = Position(t.mEngine, BallByNumber(numbered, i));
+			Geometry::Sphere3D obj(center, 2.0);
+			for(uint32_t p = 1; p < t.mPockets.mCorners.size(); ++p)
+			{
+				const Geometry::Point3D &corner = t.mPockets.mCorners[p];
+				Geometry::Ray3D los(obj.center, corner - obj.center);
+				float shot_mod = 0;
+				for(uint32_t j = 1; j < numbered.size(); ++j)
+				{
+					Geometry::Sphere3D obstruct(Position(t.mEngine, numbered[j]), 2.0);
+
+					// GhostBall(), which looked the ball up again
+					Geometry::Point3D B = Position(t.mEngine, BallByNumber(numbered, i));
+					Geometry::Vector3D U(B - corner);
+					Geometry::Point3D ghost = corner + U + 2.f * U.normal();
+					Geometry::Ray3D aim(cue, ghost - cue);
+
+					if(Geometry::Intersects(los, obstruct, 0))
+						shot_mod--;
+					Geometry::LineSeg3D seg(cue, ghost);
+					std::pair< Geometry::Point3D, Geometry::Point3D > int_pt;
+					int hits = 0;
+					if((hits = Geometry::Intersects(aim, obstruct, &int_pt)) != 0)
+					{
+						if(hits == 1)
+							if(seg.contains(int_pt.first))
+								shot_mod--;
+						if(seg.contains(int_pt.first) || seg.contains(int_pt.second))
+							shot_mod--;
+					}
+
+					inputs.push_back(AI::convert_distance(AI::max_len, AI::ideal_bp, los.direction.length()));
+					inputs.push_back(AI::convert_distance(AI::max_len, AI::ideal_bb, aim.direction.length()));
+					inputs.push_back(los.direction.normal() * aim.direction.normal());
+					LegacyShot sh = { aim.direction.normal(), ghost, 0.f };
+					shots.push_back(sh);
+				}
+			}
+		}
+
+		int outs = net.OutputCount();
+		scores.resize(shots.size() * outs);
+		net.RunBatch(&inputs[0], (int)shots.size(), &scores[0]);
+		for(size_t i = 0; i < shots.size(); ++i)
+			shots[i].mScore = scores[i * outs];
+		std::sort(shots.begin(), shots.end());
+
+		Choice c = { shots.back().mAim, shots.back().mScore, (uint32_t)shots.size() };
+		return c;
+	}
+
+	/// SelectShot's loop now: one pass over the table, then the planner.
+	Choice Planned(Table &t, AI::NeuralNet &net, AI::ShotPlanner &planner)
+	{
+		planner.Clear(Position(t.mEngine, t.mCue));
+		for(size_t i = 0; i < t.mBalls.size(); ++i)
+			planner.AddBall(Position(t.mEngine, t.mBalls[i]), true);
+		for(size_t p = 1; p < t.mPockets.mCorners.size(); ++p)
+			planner.AddPocket(t.mPockets.mCorners[p]);
+		planner.Plan(&net);
+
+		uint32_t best = planner.Best();
+		Choice c = { planner.Aim(best).normal(), planner.Score(best), planner.Count() };
+		return c;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const char *netFile = "data/AIPlayer.bpn";
+	int reps = 200;
+	for(int i = 1; i < argc; ++i)
+	{
+		if(std::strcmp(argv[i], "--net") == 0 && i + 1 < argc)
+			netFile = argv[++i];
+		else if(std::strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+			reps = std::max(1, std::atoi(argv[++i]));
+		else
+		{
+			std::fprintf(stderr, "usage: aibench [--net file] [--reps n]\n");
+			return 2;
+		}
+	}
+	std::FILE *check = std::fopen(netFile, "rb");
+	if(!check)
+	{
+		std::fprintf(stderr, "aibench: cannot open %s\n", netFile);
+		return 1;
+	}
+	std::fclose(check);
+	AI::NeuralNet net((std::string(netFile)));
+
+	std::printf("%-10s %6s %11s %11s %11s %11s %8s %5s\n", "table", "balls", "rows_old", "rows_new",
+		"legacy_us", "planner_us", "speedup", "same");
+	const int kinds[2] = { 18, 19 };
+	bool allSame = true;
+	for(int b = 0; b < 2; ++b)
+	{
+		for(int k = 0; k < 2; ++k)
+		{
+			Table table;
+			Rack(table, kinds[k], b == 1);
+
+			std::vector< float > inputs, scores;
+			AI::ShotPlanner planner;
+			std::vector< double > legacy, planned;
+			Choice before = Legacy(table, net, inputs, scores);
+			Choice after = Planned(table, net, planner);
+			for(int r = 0; r < reps; ++r)
+			{
+				Clock::time_point t0 = Clock::now();
+				before = Legacy(table, net, inputs, scores);
+				Clock::time_point t1 = Clock::now();
+				after = Planned(table, net, planner);
+				Clock::time_point t2 = Clock::now();
+				legacy.push_back(Micros(t0, t1));
+				planned.push_back(Micros(t1, t2));
+			}
+
+			// a symmetric rack ties shots, which the old sort broke any way it
+			// liked, and the ghost ball is worked out in a different order
+			bool same = std::fabs(before.mScore - after.mScore) < 1e-5f;
+			allSame = allSame && same;
+			char name[16];
+			std::sprintf(name, "%s%d", b ? "break" : "rack", kinds[k]);
+			double ms[2] = { Median(legacy), Median(planned) };
+			std::printf("%-10s %6u %11u %11u %11.1f %11.1f %8.2f %5s\n", name, (unsigned)table.mBalls.size(),
+				before.mCandidates, after.mCandidates, ms[0], ms[1], ms[0] / ms[1], same ? "yes" : "NO");
+		}
+	}
+	return allSame ? 0 : 1;
+}
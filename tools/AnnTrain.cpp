@@ -0,0 +1,608 @@
+/*!
+	@file	AnnTrain.cpp
+	@date	October 17, 2026
+
+	@brief	Trains the AI player's network from a shot log.
+
+		Usage: anntrain --data file --out file [--hidden n,n...] [--init file]
+		                [--optimizer adam|sgd] [--rate r] [--momentum m]
+		                [--batch n] [--epochs n] [--patience n] [--holdout n]
+		                [--workers n] [--seed n]
+
+		Reads a shot log (see ShotLog.h) and trains a network laid out the
+		way AI::NeuralNet runs it: the inputs plus a bias of 1 feed each
+		layer of sigmoid units in turn, with no bias past the first layer.
+		--hidden gives the hidden layer sizes (default 3,2, the shape of
+		the shipped AIPlayer.bpn); --init starts from an existing .bpn
+		instead of random weights.
+
+		Every --holdout'th record (default 10; 0 for none) is kept back to
+		validate on. The rest are streamed from the log a block at a time
+		each epoch, shuffled within the block, and cut into mini-batches of
+		--batch (default 256). Each mini-batch is split into chunks of 32
+		samples across --workers threads (default one per core); the
+		chunks' gradients are summed in chunk order, so the result does not
+		depend on the worker count. The weights step by Adam (default, rate
+		.01) or by gradient descent with --momentum (default .9, rate .3).
+
+		Training stops after --epochs (default 200), or once the validation
+		loss has not improved for --patience epochs (default 10). The best
+		weights seen are written to --out as a .bpn that NeuralNet loads.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "JobPool.h"
+#include "ShotLog.h"
+#include "TableSetup.h"
+
+using TableSetup::Clock;
+using TableSetup::Lcg;
+using TableSetup::Millis;
+
+namespace
+{
+	const uint32_t kChunk	= 32;		///< Samples per work item; gradients are summed per chunk.
+	const uint32_t kBlock	= 65536;	///< Records read from the log at a time.
+	const float kAdamBeta1	= .9f;
+	const float kAdamBeta2	= .999f;
+	const float kAdamEps	= 1e-8f;
+
+	struct Options
+	{
+		Options() : mData(0), mOut(0), mInit(0), mHidden("3,2"), mAdam(true), mRate(-1.f), mMomentum(.9f),
+			mBatch(256), mEpochs(200), mPatience(10), mHoldout(10), mWorkers(0), mSeed(1) {}
+		const char*	mData;
+		const char*	mOut;
+		const char*	mInit;
+		const char*	mHidden;
+		bool		mAdam;
+		float		mRate;			///< Below 0 picks the optimizer's default.
+		float		mMomentum;
+		uint32_t	mBatch;
+		int			mEpochs;
+		int			mPatience;
+		uint32_t	mHoldout;
+		unsigned	mWorkers;
+		uint32_t	mSeed;
+	};
+
+	/*!
+	 @brief	The weights of a NeuralNet, one row-major matrix per layer.
+
+		mSizes are the .bpn layer sizes, so the first counts the bias.
+		Activations and error terms for one sample are kept layer after
+		layer in one array, starting at mUnit[layer].
+	*//*__________________________________________________________________________*/
+	struct Net
+	{
+		std::vector< int >		mSizes;
+		std::vector< uint32_t >	mOffset;	///< Start of each layer's rows in mWeights.
+		std::vector< uint32_t >	mUnit;		///< Start of each layer in an activation array.
+		std::vector< float >	mWeights;
+
+		void Shape(const std::vector< int > &sizes)
+		{
+			mSizes = sizes;
+			mOffset.assign(sizes.size(), 0);
+			mUnit.assign(sizes.size() + 1, 0);
+			uint32_t weights = 0;
+			for(size_t i = 0; i < sizes.size(); ++i)
+			{
+				if(i > 0)
+				{
+					mOffset[i] = weights;
+					weights += sizes[i] * sizes[i - 1];
+				}
+				mUnit[i + 1] = mUnit[i] + sizes[i];
+			}
+			mWeights.assign(weights, 0.f);
+		}
+		uint32_t Units(void) const	{ return mUnit.back(); }
+
+		void Randomize(Lcg &rng)
+		{
+			for(size_t i = 1; i < mSizes.size(); ++i)
+			{
+				float range = 1.f / std::sqrt((float)mSizes[i - 1]);
+				uint32_t end = i + 1 < mSizes.size() ? mOffset[i + 1] : (uint32_t)mWeights.size();
+				for(uint32_t w = mOffset[i]; w < end; ++w)
+					mWeights[w] = rng.Range(-range, range);
+			}
+		}
+
+		/// Same file format as NeuralNet::Load and Save.
+		bool Load(const char *file)
+		{
+			std::ifstream in(file);
+			int layers = 0;
+			if(!(in >> layers) || layers < 2)
+				return false;
+			std::vector< int > sizes(layers);
+			for(int i = 0; i < layers; ++i)
+				if(!(in >> sizes[i]) || sizes[i] < 1)
+					return false;
+			Shape(sizes);
+			for(size_t w = 0; w < mWeights.size(); ++w)
+				if(!(in >> mWeights[w]))
+					return false;
+			return true;
+		}
+		bool Save(const char *file) const
+		{
+			FILE *f = std::fopen(file, "w");
+			if(!f)
+				return false;
+			std::fprintf(f, "%d\n", (int)mSizes.size());
+			for(size_t i = 0; i < mSizes.size(); ++i)
+				std::fprintf(f, "%d\n", mSizes[i]);
+			// enough digits that NeuralNet reads back the same floats
+			for(size_t w = 0; w < mWeights.size(); ++w)
+				std::fprintf(f, "%.9g\n", mWeights[w]);
+			return std::fclose(f) == 0;
+		}
+
+		/// As NeuralNet::Run, leaving every layer's outputs in act.
+		void Forward(const float *input, float *act) const
+		{
+			act[0] = 1.f;
+			for(int k = 1; k < mSizes[0]; ++k)
+				act[k] = input[k - 1];
+			for(size_t i = 1; i < mSizes.size(); ++i)
+			{
+				const int rows = mSizes[i], cols = mSizes[i - 1];
+				const float *prev = act + mUnit[i - 1];
+				float *out = act + mUnit[i];
+				for(int j = 0; j < rows; ++j)
+				{
+					const float *w = &mWeights[mOffset[i] + j * cols];
+					float sum = 0.f;
+					for(int k = 0; k < cols; ++k)
+						sum += prev[k] * w[k];
+					out[j] = 1.f / (1.f + std::exp(-sum));
+				}
+			}
+		}
+
+		/*!
+		 @param act		From Forward().
+		 @param target
+		 @param err		Scratch, Units() long.
+		 @param grad	The sample's gradient is added here.
+		 @return		The sample's squared error.
+
+		 NeuralNet::Train's error terms; grad points the way Train moves
+		 the weights, downhill on half the squared error.
+		*//*__________________________________________________________________________*/
+		float Backward(const float *act, const float *target, float *err, float *grad) const
+		{
+			const size_t last = mSizes.size() - 1;
+			float loss = 0.f;
+			for(int j = 0; j < mSizes[last]; ++j)
+			{
+				float o = act[mUnit[last] + j];
+				float e = target[j] - o;
+				loss += e * e;
+				err[mUnit[last] + j] = o * (1.f - o) * e;
+			}
+			for(size_t i = last; i > 1; --i)
+			{
+				const int rows = mSizes[i], cols = mSizes[i - 1];
+				for(int k = 0; k < cols; ++k)
+				{
+					float sum = 0.f;
+					for(int j = 0; j < rows; ++j)
+						sum += err[mUnit[i] + j] * mWeights[mOffset[i] + j * cols + k];
+					float o = act[mUnit[i - 1] + k];
+					err[mUnit[i - 1] + k] = o * (1.f - o) * sum;
+				}
+			}
+			for(size_t i = 1; i <= last; ++i)
+			{
+				const int rows = mSizes[i], cols = mSizes[i - 1];
+				const float *prev = act + mUnit[i - 1];
+				for(int j = 0; j < rows; ++j)
+				{
+					float e = err[mUnit[i] + j];
+					float *g = grad + mOffset[i] + j * cols;
+					for(int k = 0; k < cols; ++k)
+						g[k] += e * prev[k];
+				}
+			}
+			return loss;
+		}
+	};
+
+	/// Reads a shot log a block of records at a time.
+	struct LogReader
+	{
+		LogReader() : mFile(0), mCount(0) {}
+		~LogReader()	{ if(mFile) std::fclose(mFile); }
+
+		bool Open(const char *file)
+		{
+			mFile = std::fopen(file, "rb");
+			if(!mFile || std::fread(&mHeader, sizeof(mHeader), 1, mFile) != 1)
+				return false;
+			if(mHeader.mMagic != AI::kShotLogMagic || mHeader.mVersion != AI::kShotLogVersion
+				|| mHeader.mInputs == 0 || mHeader.mOutputs == 0)
+				return false;
+			std::fseek(mFile, 0, SEEK_END);
+			long bytes = std::ftell(mFile) - (long)sizeof(mHeader);
+			if(bytes < 0 || bytes % RecordBytes() != 0)
+				return false;
+			mCount = (uint64_t)bytes / RecordBytes();
+			Rewind();
+			return true;
+		}
+		void Rewind(void)				{ std::fseek(mFile, (long)sizeof(mHeader), SEEK_SET); }
+		uint32_t Floats(void) const		{ return mHeader.mInputs + mHeader.mOutputs; }
+		long RecordBytes(void) const	{ return (long)(Floats() * sizeof(float)); }
+		/// @return Records read into block, which is resized to hold them.
+		uint32_t Read(std::vector< float > &block)
+		{
+			block.resize((size_t)kBlock * Floats());
+			uint32_t got = (uint32_t)std::fread(&block[0], RecordBytes(), kBlock, mFile);
+			block.resize((size_t)got * Floats());
+			return got;
+		}
+
+		FILE*				mFile;
+		AI::ShotLogHeader	mHeader;
+		uint64_t			mCount;
+	};
+
+	/*!
+	 @brief	Works out a mini-batch's gradient in chunks across the pool.
+
+		Every chunk has its own gradient and scratch, so the workers never
+		share a write, and the chunks are added up in order afterwards.
+	*//*__________________________________________________________________________*/
+	class Trainer
+	{
+	public:
+		Trainer(Net &net, const Options &opts, uint32_t inputs, uint32_t outputs)
+			: mNet(net), mOpts(opts), mInputs(inputs), mOutputs(outputs), mJobs(opts.mWorkers), mStep(0)
+		{
+			uint32_t chunks = (opts.mBatch + kChunk - 1) / kChunk;
+			mChunkGrad.resize((size_t)chunks * net.mWeights.size());
+			mChunkLoss.resize(chunks);
+			mChunkHits.resize(chunks);
+			mScratch.resize((size_t)chunks * 2 * net.Units());
+			mGrad.resize(net.mWeights.size());
+			mMoment1.assign(net.mWeights.size(), 0.f);
+			mMoment2.assign(net.mWeights.size(), 0.f);
+		}
+
+		/*!
+		 @param records	Samples, inputs then targets.
+		 @param order	Indices into records of the mini-batch.
+		 @param count
+		 @return The summed squared error before the step.
+		*//*__________________________________________________________________________*/
+		double Step(const float *records, const uint32_t *order, uint32_t count)
+		{
+			const uint32_t chunks = (count + kChunk - 1) / kChunk;
+			const size_t weights = mNet.mWeights.size();
+			Physics::JobPool::RangeFn fn = [&](uint32_t begin, uint32_t end)
+			{
+				for(uint32_t c = begin; c < end; ++c)
+				{
+					float *grad = &mChunkGrad[c * weights];
+					float *act = &mScratch[c * 2 * mNet.Units()];
+					float *err = act + mNet.Units();
+					std::fill(grad, grad + weights, 0.f);
+					double loss = 0.;
+					for(uint32_t s = c * kChunk; s < std::min(count, (c + 1) * kChunk); ++s)
+					{
+						const float *record = records + (size_t)order[s] * (mInputs + mOutputs);
+						mNet.Forward(record, act);
+						loss += mNet.Backward(act, record + mInputs, err, grad);
+					}
+					mChunkLoss[c] = loss;
+				}
+			};
+			mJobs.ParallelFor(chunks, 1, fn);
+
+			double loss = 0.;
+			std::fill(mGrad.begin(), mGrad.end(), 0.f);
+			for(uint32_t c = 0; c < chunks; ++c)
+			{
+				const float *grad = &mChunkGrad[c * weights];
+				for(size_t w = 0; w < weights; ++w)
+					mGrad[w] += grad[w];
+				loss += mChunkLoss[c];
+			}
+			Update(1.f / count);
+			return loss;
+		}
+
+		/*!
+		 @param records	Samples, inputs then targets.
+		 @param count
+		 @param hits	Receives how many samples had every output on the
+						right side of .5.
+		 @return The summed squared error.
+		*//*__________________________________________________________________________*/
+		double Evaluate(const float *records, uint32_t count, uint32_t &hits)
+		{
+			double loss = 0.;
+			hits = 0;
+			for(uint32_t base = 0; base < count; base += (uint32_t)mChunkLoss.size() * kChunk)
+			{
+				const uint32_t n = std::min(count - base, (uint32_t)mChunkLoss.size() * kChunk);
+				const uint32_t chunks = (n + kChunk - 1) / kChunk;
+				Physics::JobPool::RangeFn fn = [&](uint32_t begin, uint32_t end)
+				{
+					for(uint32_t c = begin; c < end; ++c)
+					{
+						float *act = &mScratch[c * 2 * mNet.Units()];
+						const float *out = act + mNet.mUnit[mNet.mSizes.size() - 1];
+						double chunkLoss = 0.;
+						uint32_t chunkHits = 0;
+						for(uint32_t s = base + c * kChunk; s < base + std::min(n, (c + 1) * kChunk); ++s)
+						{
+							const float *record = records + (size_t)s * (mInputs + mOutputs);
+							const float *target = record + mInputs;
+							mNet.Forward(record, act);
+							bool hit = true;
+							for(uint32_t j = 0; j < mOutputs; ++j)
+							{
+								float e = target[j] - out[j];
+								chunkLoss += e * e;
+								hit = hit && ((out[j] > .5f) == (target[j] > .5f));
+							}
+							chunkHits += hit;
+						}
+						mChunkLoss[c] = chunkLoss;
+						mChunkHits[c] = chunkHits;
+					}
+				};
+				mJobs.ParallelFor(chunks, 1, fn);
+				for(uint32_t c = 0; c < chunks; ++c)
+				{
+					loss += mChunkLoss[c];
+					hits += mChunkHits[c];
+				}
+			}
+			return loss;
+		}
+
+	private:
+		/// @param scale	One over the batch size; mGrad holds the batch's sum.
+		void Update(float scale)
+		{
+			std::vector< float > &w = mNet.mWeights;
+			if(mOpts.mAdam)
+			{
+				++mStep;
+				const float fix1 = 1.f - std::pow(kAdamBeta1, (float)mStep);
+				const float fix2 = 1.f - std::pow(kAdamBeta2, (float)mStep);
+				for(size_t i = 0; i < w.size(); ++i)
+				{
+					float g = mGrad[i] * scale;
+					mMoment1[i] = kAdamBeta1 * mMoment1[i] + (1.f - kAdamBeta1) * g;
+					mMoment2[i] = kAdamBeta2 * mMoment2[i] + (1.f - kAdamBeta2) * g * g;
+					w[i] += mOpts.mRate * (mMoment1[i] / fix1) / (std::sqrt(mMoment2[i] / fix2) + kAdamEps);
+				}
+			}
+			else
+			{
+				for(size_t i = 0; i < w.size(); ++i)
+				{
+					mMoment1[i] = mOpts.mMomentum * mMoment1[i] + mOpts.mRate * mGrad[i] * scale;
+					w[i] += mMoment1[i];
+				}
+			}
+		}
+
+		Net&					mNet;
+		const Options&			mOpts;
+		uint32_t				mInputs, mOutputs;
+		Physics::JobPool		mJobs;
+		uint32_t				mStep;			///< Adam's step count.
+		std::vector< float >	mChunkGrad;		///< One gradient per chunk, back to back.
+		std::vector< double >	mChunkLoss;
+		std::vector< uint32_t >	mChunkHits;
+		std::vector< float >	mScratch;		///< Activations and error terms per chunk.
+		std::vector< float >	mGrad;
+		std::vector< float >	mMoment1;		///< Adam's first moment, or the momentum velocity.
+		std::vector< float >	mMoment2;
+	};
+
+	bool ParseHidden(const char *text, std::vector< int > &sizes)
+	{
+		while(*text)
+		{
+			char *end = 0;
+			long n = std::strtol(text, &end, 10);
+			if(end == text || n < 1)
+				return false;
+			sizes.push_back((int)n);
+			text = *end == ',' ? end + 1 : end;
+			if(*end && *end != ',')
+				return false;
+		}
+		return true;
+	}
+
+	bool ParseArgs(int argc, char **argv, Options &opts)
+	{
+		for(int i = 1; i < argc; ++i)
+		{
+			std::string arg(argv[i]);
+			if(i + 1 >= argc)
+				return false;
+			const char *value = argv[++i];
+			if(arg == "--data")
+				opts.mData = value;
+			else if(arg == "--out")
+				opts.mOut = value;
+			else if(arg == "--init")
+				opts.mInit = value;
+			else if(arg == "--hidden")
+				opts.mHidden = value;
+			else if(arg == "--optimizer" && (std::strcmp(value, "adam") == 0 || std::strcmp(value, "sgd") == 0))
+				opts.mAdam = std::strcmp(value, "adam") == 0;
+			else if(arg == "--rate")
+				opts.mRate = (float)std::atof(value);
+			else if(arg == "--momentum")
+				opts.mMomentum = (float)std::atof(value);
+			else if(arg == "--batch")
+				opts.mBatch = (uint32_t)std::max(1, std::atoi(value));
+			else if(arg == "--epochs")
+				opts.mEpochs = std::max(1, std::atoi(value));
+			else if(arg == "--patience")
+				opts.mPatience = std::max(1, std::atoi(value));
+			else if(arg == "--holdout")
+				opts.mHoldout = (uint32_t)std::max(0, std::atoi(value));
+			else if(arg == "--workers")
+				opts.mWorkers = (unsigned)std::atoi(value);
+			else if(arg == "--seed")
+				opts.mSeed = (uint32_t)std::strtoul(value, 0, 10);
+			else
+				return false;
+		}
+		if(opts.mWorkers == 0)
+			opts.mWorkers = std::max(1u, std::thread::hardware_concurrency());
+		if(opts.mRate < 0.f)
+			opts.mRate = opts.mAdam ? .01f : .3f;
+		return opts.mData && opts.mOut;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options opts;
+	if(!ParseArgs(argc, argv, opts))
+	{
+		std::fprintf(stderr, "usage: anntrain --data file --out file [--hidden n,n...] [--init file]\n"
+			"                [--optimizer adam|sgd] [--rate r] [--momentum m]\n"
+			"                [--batch n] [--epochs n] [--patience n] [--holdout n]\n"
+			"                [--workers n] [--seed n]\n");
+		return 2;
+	}
+
+	LogReader log;
+	if(!log.Open(opts.mData))
+	{
+		std::fprintf(stderr, "anntrain: %s is not a shot log\n", opts.mData);
+		return 1;
+	}
+	const uint32_t inputs = log.mHeader.mInputs, outputs = log.mHeader.mOutputs;
+	const uint32_t floats = log.Floats();
+
+	Net net;
+	Lcg rng(opts.mSeed);
+	if(opts.mInit)
+	{
+		if(!net.Load(opts.mInit) || net.mSizes.front() != (int)inputs + 1 || net.mSizes.back() != (int)outputs)
+		{
+			std::fprintf(stderr, "anntrain: %s does not fit a log of %u inputs and %u outputs\n", opts.mInit, inputs, outputs);
+			return 1;
+		}
+	}
+	else
+	{
+		std::vector< int > sizes(1, (int)inputs + 1);
+		if(!ParseHidden(opts.mHidden, sizes))
+		{
+			std::fprintf(stderr, "anntrain: bad --hidden %s\n", opts.mHidden);
+			return 2;
+		}
+		sizes.push_back((int)outputs);
+		net.Shape(sizes);
+		net.Randomize(rng);
+	}
+
+	// the validation set is every holdout'th record; it is small enough to keep
+	std::vector< float > block, valid;
+	uint64_t record = 0, trainCount = 0;
+	for(uint32_t got; (got = log.Read(block)) != 0; record += got)
+	{
+		for(uint32_t r = 0; r < got; ++r)
+		{
+			if(opts.mHoldout && (record + r) % opts.mHoldout == 0)
+				valid.insert(valid.end(), &block[(size_t)r * floats], &block[(size_t)(r + 1) * floats]);
+			else
+				++trainCount;
+		}
+	}
+	const uint32_t validCount = (uint32_t)(valid.size() / floats);
+	std::fprintf(stderr, "anntrain: %llu records, %llu to train on, %u to validate; %u workers, %s\n",
+		(unsigned long long)log.mCount, (unsigned long long)trainCount, validCount, opts.mWorkers,
+		opts.mAdam ? "adam" : "sgd");
+	if(trainCount == 0)
+	{
+		std::fprintf(stderr, "anntrain: nothing to train on\n");
+		return 1;
+	}
+
+	Trainer trainer(net, opts, inputs, outputs);
+	std::vector< float > best = net.mWeights;
+	double bestLoss = -1.;
+	int bestEpoch = 0, waited = 0;
+	std::vector< float > train;
+	std::vector< uint32_t > order;
+	for(int epoch = 1; epoch <= opts.mEpochs; ++epoch)
+	{
+		Clock::time_point t0 = Clock::now();
+		double trainLoss = 0.;
+		log.Rewind();
+		record = 0;
+		for(uint32_t got; (got = log.Read(block)) != 0; record += got)
+		{
+			// keep the block's training records, then shuffle them
+			train.clear();
+			for(uint32_t r = 0; r < got; ++r)
+				if(!(opts.mHoldout && (record + r) % opts.mHoldout == 0))
+					train.insert(train.end(), &block[(size_t)r * floats], &block[(size_t)(r + 1) * floats]);
+			uint32_t count = (uint32_t)(train.size() / floats);
+			order.resize(count);
+			for(uint32_t i = 0; i < count; ++i)
+				order[i] = i;
+			for(uint32_t i = count; i > 1; --i)
+				std::swap(order[i - 1], order[rng.Next() % i]);
+
+			for(uint32_t at = 0; at < count; at += opts.mBatch)
+				trainLoss += trainer.Step(&train[0], &order[at], std::min(opts.mBatch, count - at));
+		}
+		trainLoss /= (double)trainCount * outputs;
+
+		uint32_t hits = 0;
+		double validLoss = validCount ? trainer.Evaluate(&valid[0], validCount, hits) / ((double)validCount * outputs) : trainLoss;
+		std::fprintf(stderr, "anntrain: epoch %d train %.6f valid %.6f acc %.4f %.0f ms\n", epoch, trainLoss, validLoss,
+			validCount ? (double)hits / validCount : 0., Millis(t0, Clock::now()));
+
+		// without a validation set the last epoch is kept
+		if(bestLoss < 0. || validLoss < bestLoss || !validCount)
+		{
+			bestLoss	= validLoss;
+			bestEpoch	= epoch;
+			best		= net.mWeights;
+			waited		= 0;
+		}
+		else if(++waited >= opts.mPatience)
+			break;
+	}
+
+	net.mWeights = best;
+	if(!net.Save(opts.mOut))
+	{
+		std::fprintf(stderr, "anntrain: cannot write %s\n", opts.mOut);
+		return 1;
+	}
+	std::printf("anntrain: wrote %s from epoch %d, %s loss %.6f\n", opts.mOut, bestEpoch, validCount ? "validation" : "training", bestLoss);
+	return 0;
+}
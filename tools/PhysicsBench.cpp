@@ -0,0 +1,442 @@
+/*!
+	@file	PhysicsBench.cpp
+	@date	October 17, 2026
+
+	@brief	Headless timing runs for the physics engine.
+
+		Usage: physbench [max_spheres] [workers]
+
+		Times the collision broadphase against the old all-pairs loop, and
+		whole simulation steps, from the 19-ball rack up to max_spheres
+		(default 5000) free spheres at game density. Then times single
+		narrowphase contacts at growing body counts. Last, runs each field
+		on one thread and on workers threads (default one per core) and
+		checks that both end in the same state. Then plays two batches of
+		shots to rest with ShotBatch, the same way: perturbed breaks, which
+		seldom drop a ball, and cuts toward the corner pockets, which drop
+		about one each, so the check covers the pocketed lists. Last,
+		runs fast spheres at growing step sizes with and without the event
+		solver, counting spheres that sank into each other along the way and
+		ones that ended up through a wall.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Physics.h"
+#include "PhysicsAux.h"
+#include "ShotBatch.h"
+#include "TableSetup.h"
+
+using Physics::Engine;
+using Physics::BodyStore;
+using namespace TableSetup;
+
+namespace
+{
+	/*!
+	 @param e
+
+	 The 19-ball rack with the cue ball struck down the long axis.
+	*//*__________________________________________________________________________*/
+	void BuildRack19(Engine &e)
+	{
+		AddTable(e);
+		std::vector< Vector3D > pos;
+		pos.push_back(Vector3D(0, 0, -25));
+		Rack19(pos);
+		for(size_t i = 0; i < pos.size(); ++i)
+			AddBall(e, pos[i], i == 0 ? Vector3D(.05f, .02f, 1.f) * 50.f : Vector3D());
+	}
+
+	/*!
+	 @param bodies
+	 @param dt
+	 @return The number of pairs the all-pairs loop in Simulate used to hand the narrowphase.
+	*//*__________________________________________________________________________*/
+	size_t AllPairs(BodyStore &bodies, Real dt)
+	{
+		size_t pairs = 0;
+		for(uint32_t b1 = 0; b1 < bodies.Count(); ++b1)
+		{
+			Physics::RigidBody* body1 = bodies.Body(b1);
+			if(!body1->Collidable())
+				continue;
+			Vector3D disp = -body1->VelocityT0();
+			for(uint32_t b2 = b1 + 1; b2 < bodies.Count(); ++b2)
+			{
+				Physics::RigidBody* body2 = bodies.Body(b2);
+				if(!body2->Collidable())
+					continue;
+				if(body1->VelocityT0().length() < kEpsilon && body2->VelocityT0().length() < kEpsilon)
+					continue;
+				if(body1->mCollideGeom->Kind() == Physics::kC_Sphere && body2->mCollideGeom->Kind() == Physics::kC_Sphere)
+				{
+					Vector3D pos1 = body1->PositionT0();
+					Vector3D vel = body2->VelocityT0() + disp;
+					Vector3D pos2 = body2->PositionT0() + vel * dt;
+					if(Math::Abs((Real)(pos1[2] - pos2[2])) >= 3.f)
+						continue;
+					if(Math::Abs((Real)(pos1[0] - pos2[0])) >= 3.f)
+						continue;
+					if(Math::Abs((Real)(pos1[1] - pos2[1])) >= 3.f)
+						continue;
+				}
+				++pairs;
+			}
+		}
+		return pairs;
+	}
+
+	/*!
+	 @param name	Scene label.
+	 @param e		The built scene.
+	 @param steps	Number of substeps to time.
+	*//*__________________________________________________________________________*/
+	void RunScene(const char *name, Engine &e, int steps)
+	{
+		BodyStore &bodies = e.mAuxEngine->mBodies;
+		ReserveContacts(e);
+
+		double simMs = 0., broadMs = 0., allMs = 0.;
+		size_t broadPairs = 0, allPairs = 0;
+		for(int i = 0; i < steps; ++i)
+		{
+			Clock::time_point t0 = Clock::now();
+			e.Simulate(kSubstep);
+			Clock::time_point t1 = Clock::now();
+			simMs += Millis(t0, t1);
+
+			// both candidate generators on the same state
+			t0 = Clock::now();
+			e.mAuxEngine->mBroadphase.Update(bodies, kSubstep);
+			t1 = Clock::now();
+			allPairs += AllPairs(bodies, kSubstep);
+			Clock::time_point t2 = Clock::now();
+			broadMs += Millis(t0, t1);
+			allMs += Millis(t1, t2);
+			broadPairs += e.mAuxEngine->mBroadphase.mPairs.size();
+		}
+		std::printf("%-10s %7u %12.4f %12.4f %12.4f %10.1f %10.1f\n", name, bodies.Count(),
+			simMs / steps, broadMs / steps, allMs / steps, (double)broadPairs / steps, (double)allPairs / steps);
+	}
+
+	/*!
+	 @param bodies
+	 @return A checksum over the end-of-step positions and velocities.
+	*//*__________________________________________________________________________*/
+	uint64_t StateHash(BodyStore &bodies)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for(uint32_t i = 0; i < bodies.Count(); ++i)
+		{
+			const Real* words[2] = { &bodies.mPositionT1[i][0], &bodies.mVelocityT1[i][0] };
+			for(int w = 0; w < 2; ++w)
+				for(int c = 0; c < 3; ++c)
+				{
+					uint32_t bits;
+					std::memcpy(&bits, &words[w][c], sizeof(bits));
+					hash = (hash ^ bits) * 1099511628211ull;
+				}
+		}
+		return hash;
+	}
+
+	/*!
+	 @param count	Number of spheres.
+	 @param workers	Threads for the second run.
+	 @param steps	Number of substeps to time.
+	*//*__________________________________________________________________________*/
+	void RunThreadScene(int count, unsigned workers, int steps)
+	{
+		double ms[2];
+		uint64_t hash[2];
+		for(int run = 0; run < 2; ++run)
+		{
+			Engine e;
+			e.SetGravity(Vector3D(0, 0, 0));
+			e.SetMinTimeStep(1.f / 1000.f);
+			e.SetWorkerCount(run == 0 ? 1 : workers);
+			BuildField(e, count);
+			BodyStore &bodies = e.mAuxEngine->mBodies;
+			ReserveContacts(e);
+
+			Clock::time_point t0 = Clock::now();
+			for(int i = 0; i < steps; ++i)
+				e.Simulate(kSubstep);
+			ms[run] = Millis(t0, Clock::now()) / steps;
+			hash[run] = StateHash(bodies);
+		}
+		std::printf("field%-5d %7u %12.4f %12.4f %10.2f %6s\n", count, workers, ms[0], ms[1], ms[0] / ms[1],
+			hash[0] == hash[1] ? "yes" : "NO");
+	}
+
+	/*!
+	 @param e
+	 @return Which way each object ball lies from the cue ball.
+
+	 The cue ball in the middle of the table and an object ball 10 units
+	 out toward each corner pocket, so a shot along one drops it.
+	*//*__________________________________________________________________________*/
+	std::vector< Vector3D > BuildCorners(Engine &e)
+	{
+		AddTable(e);
+		AddBall(e, Vector3D());
+		std::vector< Vector3D > aims;
+		for(int sx = -1; sx <= 1; sx += 2)
+			for(int sy = -1; sy <= 1; sy += 2)
+				for(int sz = -1; sz <= 1; sz += 2)
+				{
+					aims.push_back(Vector3D(sx * kHalfWidth, sy * kHalfHeight, sz * kHalfDepth).normal());
+					AddBall(e, aims.back() * 10.f);
+				}
+		return aims;
+	}
+
+	/*!
+	 @param scene	Name to print.
+	 @param table	The table to shoot on.
+	 @param shots
+	 @param workers	Threads for the second run.
+
+	 Plays the shots to rest on one thread, then on workers threads, and
+	 checks both runs report the same outcomes.
+	*//*__________________________________________________________________________*/
+	void RunShotBatch(const char* scene, const Engine &table, const std::vector< Physics::ShotParams > &shots, unsigned workers)
+	{
+		int count = (int)shots.size();
+		double ms[2];
+		uint64_t hash[2];
+		int pocketed = 0, frames = 0;
+		for(int run = 0; run < 2; ++run)
+		{
+			Physics::ShotBatch batch(run == 0 ? 1 : workers);
+			batch.SetTable(table);
+			std::vector< Physics::ShotOutcome > outcomes;
+			Clock::time_point t0 = Clock::now();
+			batch.Run(shots, outcomes);
+			ms[run] = Millis(t0, Clock::now());
+
+			hash[run] = 14695981039346656037ull;
+			pocketed = frames = 0;
+			for(size_t i = 0; i < outcomes.size(); ++i)
+			{
+				const Physics::ShotOutcome &o = outcomes[i];
+				pocketed += (int)o.mPocketed.size();
+				frames += o.mFrames;
+				hash[run] = (hash[run] ^ o.mFirstContact ^ ((uint64_t)o.mPocketed.size() << 32)) * 1099511628211ull;
+				for(size_t b = 0; b < o.mPocketed.size(); ++b)
+					hash[run] = (hash[run] ^ o.mPocketed[b] ^ ((uint64_t)o.mPockets[b] << 32)) * 1099511628211ull;
+				for(size_t b = 0; b < o.mFinalPositions.size(); ++b)
+					for(int c = 0; c < 3; ++c)
+					{
+						uint32_t bits;
+						std::memcpy(&bits, &o.mFinalPositions[b][c], sizeof(bits));
+						hash[run] = (hash[run] ^ bits) * 1099511628211ull;
+					}
+			}
+		}
+		std::printf("%-10s %7u %6d %12.1f %12.1f %10.2f %6s %8.1f %8.1f\n", scene, workers, count,
+			1000. * count / ms[0], 1000. * count / ms[1], ms[0] / ms[1], hash[0] == hash[1] ? "yes" : "NO",
+			(double)pocketed / count, (double)frames / count);
+	}
+
+	/*!
+	 @param count	Number of spheres.
+	 @param dt		Step size; also the engine's minimum step, so it is not split.
+	 @param events	Use the event solver.
+
+	 Spheres at the speed limit, without drag, for two seconds of play.
+	*//*__________________________________________________________________________*/
+	void RunEventScene(int count, Real dt, bool events)
+	{
+		Engine e;
+		e.SetGravity(Vector3D(0, 0, 0));
+		e.SetMinTimeStep(dt);
+		e.SetSleepThresholds(k0, k0, k0);
+		e.SetEventSolver(events, Physics::kDef_MaxEvents);
+		BuildField(e, count);
+		BodyStore &bodies = e.mAuxEngine->mBodies;
+		for(uint32_t i = 0; i < bodies.Count(); ++i)
+			if(bodies.Body(i)->Translatable())
+				bodies.mVelocityT1[i] = 50.f * bodies.mVelocityT1[i].normal();
+
+		// pairs sunk deep into each other, summed over the steps
+		int steps = (int)(2.f / dt + .5f);
+		int overlaps = 0;
+		double ms = 0.;
+		for(int s = 0; s < steps; ++s)
+		{
+			Clock::time_point t0 = Clock::now();
+			e.Simulate(dt);
+			ms += Millis(t0, Clock::now());
+			for(uint32_t i = 0; i < bodies.Count(); ++i)
+				for(uint32_t j = i + 1; j < bodies.Count(); ++j)
+					if(bodies.Body(i)->Translatable() && bodies.Body(j)->Translatable()
+						&& (bodies.mPositionT1[i] - bodies.mPositionT1[j]).length() < 1.8f * kBallRadius)
+						++overlaps;
+		}
+
+		// the walls are the first six bodies; see AddTable
+		int escaped = 0;
+		for(uint32_t i = 0; i < bodies.Count(); ++i)
+		{
+			if(!bodies.Body(i)->Translatable())
+				continue;
+			const Vector3D &p = bodies.mPositionT1[i];
+			for(uint32_t w = 0; w < 6; ++w)
+				if(Geometry::Distance(Geometry::Point3D(p[0], p[1], p[2]), ((Physics::Plane*)bodies.Body(w)->mCollideGeom)->mPlane) < k0)
+				{
+					++escaped;
+					break;
+				}
+		}
+		std::printf("%-10s %7d %8.4f %12.1f %8d %8d\n", events ? "events" : "substeps", count, dt, ms, escaped, overlaps);
+	}
+
+	void NullCallback(Collision::Contact*, Physics::RigidBody*, Physics::RigidBody*) {}
+
+	/*!
+	 @param count	Number of bystander spheres in the world.
+
+	 Times one sphere-sphere and one sphere-wall contact, callbacks attached,
+	 with count other bodies in the world. The contact bodies are created
+	 last, so any per-contact search over the bodies pays its full cost.
+	*//*__________________________________________________________________________*/
+	void RunContactScene(int count)
+	{
+		const int kIterations = 200000;
+		Engine e;
+		e.SetMinTimeStep(1.f / 1000.f);
+		e.AddPhysicsCallback(kCollisionCBSpherePlane, NullCallback);
+		e.AddPhysicsCallback(kCollisionCBSphereSphere, NullCallback);
+		AddTable(e);
+		for(int i = 0; i < count; ++i)
+			AddBall(e, Vector3D((Real)(i % 10), (Real)((i / 10) % 10), (Real)(i / 100)), Vector3D());
+
+		BodyStore &bodies = e.mAuxEngine->mBodies;
+		Collision::Engine &collide = e.mAuxEngine->mCollisionEngine;
+		Physics::RigidBody* a = bodies.Lookup(AddBall(e, Vector3D(0, 0, 0), Vector3D()));
+		Physics::RigidBody* b = bodies.Lookup(AddBall(e, Vector3D(0, 0, 0), Vector3D()));
+		Physics::RigidBody* wall = bodies.Body(0);
+
+		// overlapping and closing: a sphere-sphere contact every time
+		a->PositionT0() = Vector3D(0, 0, 0);		a->PositionT1() = Vector3D(0, 0, .1f);
+		b->PositionT0() = Vector3D(0, 0, 1.9f);		b->PositionT1() = Vector3D(0, 0, 1.9f);
+		Clock::time_point t0 = Clock::now();
+		for(int i = 0; i < kIterations; ++i)
+		{
+			collide.TestCollision(a, b);
+			collide.End();
+		}
+		Clock::time_point t1 = Clock::now();
+		double sphereNs = 1.e6 * Millis(t0, t1) / kIterations;
+
+		// crossing the top wall
+		Vector3D n = ((Physics::Plane*)wall->mCollideGeom)->mPlane.normal();
+		a->PositionT0() = (-kHalfHeight + 1.5f) * n;
+		a->PositionT1() = (-kHalfHeight + .5f) * n;
+		t0 = Clock::now();
+		for(int i = 0; i < kIterations; ++i)
+		{
+			collide.TestCollision(wall, a);
+			collide.End();
+		}
+		t1 = Clock::now();
+		double planeNs = 1.e6 * Millis(t0, t1) / kIterations;
+
+		std::printf("%-10s %7u %12.1f %12.1f\n", "contact", bodies.Count(), sphereNs, planeNs);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	int maxSpheres = argc > 1 ? std::atoi(argv[1]) : 5000;
+	unsigned workers = argc > 2 ? (unsigned)std::atoi(argv[2]) : 0;
+	if(workers == 0)
+		workers = std::max(1u, std::thread::hardware_concurrency());
+
+	std::printf("%-10s %7s %12s %12s %12s %10s %10s\n", "scene", "bodies", "step_ms", "broad_ms", "allpairs_ms", "pairs", "allpairs");
+	{
+		Engine e;
+		e.SetGravity(Vector3D(0, 0, 0));
+		e.SetMinTimeStep(1.f / 1000.f);
+		BuildRack19(e);
+		RunScene("rack19", e, 100);
+	}
+	for(int n = 19; n <= maxSpheres; n = (n < 100 ? 100 : n * 2))
+	{
+		Engine e;
+		e.SetGravity(Vector3D(0, 0, 0));
+		e.SetMinTimeStep(1.f / 1000.f);
+		BuildField(e, n);
+		char name[32];
+		std::sprintf(name, "field%d", n);
+		RunScene(name, e, n > 2000 ? 5 : 20);
+	}
+
+	std::printf("\n%-10s %7s %12s %12s\n", "scene", "bodies", "sphere_ns", "plane_ns");
+	for(int n = 16; n <= 16384; n *= 8)
+		RunContactScene(n);
+
+	std::printf("\n%-10s %7s %12s %12s %10s %6s\n", "scene", "workers", "1thread_ms", "nthread_ms", "speedup", "same");
+	for(int n = 100; n <= maxSpheres; n *= 4)
+		RunThreadScene(n, workers, n > 2000 ? 10 : 40);
+
+	std::printf("\n%-10s %7s %6s %12s %12s %10s %6s %8s %8s\n", "scene", "workers", "shots", "1thread_sps", "nthread_sps", "speedup", "same", "pocketed", "frames");
+	{
+		// perturbed break shots on the 19-ball rack
+		Engine table;
+		table.SetGravity(Vector3D(0, 0, 0));
+		table.SetMinTimeStep(1.f / 1000.f);
+		BuildRack19(table);
+		uint32_t cue = table.mAuxEngine->mBodies.Handle(14);	// first ball after the 6 walls and 8 pockets
+		table.StopMoving(cue);
+
+		std::vector< Physics::ShotParams > shots(32);
+		Lcg rng(99u);
+		for(size_t i = 0; i < shots.size(); ++i)
+		{
+			shots[i].mCueBall		= cue;
+			shots[i].mDirection		= Vector3D(.05f, .02f, 1.f);
+			shots[i].mPower			= rng.Range(30.f, 50.f);
+			shots[i].mPerturbation	= Vector3D(rng.Range(-.05f, .05f), rng.Range(-.05f, .05f), 0);
+		}
+		RunShotBatch("break19", table, shots, workers);
+	}
+	{
+		// the break rarely drops a ball; these send one at its pocket
+		Engine table;
+		table.SetGravity(Vector3D(0, 0, 0));
+		table.SetMinTimeStep(1.f / 1000.f);
+		std::vector< Vector3D > aims = BuildCorners(table);
+		uint32_t cue = table.mAuxEngine->mBodies.Handle(14);
+
+		std::vector< Physics::ShotParams > shots(32);
+		Lcg rng(7u);
+		for(size_t i = 0; i < shots.size(); ++i)
+		{
+			shots[i].mCueBall		= cue;
+			shots[i].mDirection		= aims[i % aims.size()];
+			shots[i].mPower			= rng.Range(30.f, 50.f);
+			shots[i].mPerturbation	= rng.Vector(-.02f, .02f);
+		}
+		RunShotBatch("corners", table, shots, workers);
+	}
+
+	std::printf("\n%-10s %7s %8s %12s %8s %8s\n", "solver", "bodies", "dt", "total_ms", "escaped", "overlaps");
+	for(Real dt = .001f; dt < .1f; dt *= 4.f)
+	{
+		RunEventScene(100, dt, false);
+		RunEventScene(100, dt, true);
+	}
+	return 0;
+}
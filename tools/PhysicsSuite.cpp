@@ -0,0 +1,828 @@
+/*!
+	@file	PhysicsSuite.cpp
+	@date	October 17, 2026
+
+	@brief	Repeatable physics timings in a form scripts can compare.
+
+		Usage: physsuite [--format json|csv] [--out file] [--label text]
+		                 [--reps n] [--workers n] [--max-spheres n] [--quick]
+
+		Runs a fixed set of cases and writes one record per case: its name,
+		unit, body count and the median, minimum, maximum and mean over the
+		repetitions. The cases are:
+
+		  simulate/...	One Simulate() substep on the 18- and 19-ball racks
+						as the break scatters them, on fields of 100 up to
+						max_spheres (default 10000) moving spheres, and on
+						100 spheres in tables lined with more and more
+						triangle facets, and on rows of loose spheres held
+						by 1000 up to 100000 springs.
+		  remove/...	Removing every tenth sphere of the spring rows,
+						which takes its springs with it.
+		  collide/...	One narrowphase test, sphere-sphere and plane-sphere,
+						through Collision::Engine::TestCollision.
+		  resolve/...	One Collision::Engine::Resolve of the same contacts,
+						including putting the two bodies back each time.
+		  break/...		The break shot of each rack, from the strike until
+						AtRest(), stepped as the game does; the _solver
+						cases resolve contacts with the ContactSolver, and
+						_solver_long also takes 2.5 ms substeps.
+
+		Every engine is built from the default Params, so the results do
+		not depend on data/config/physics.ini. --quick cuts the repetitions
+		and the largest field for a fast check.
+
+		It also checks the capsule, box and convex hull pairs with a
+		sphere, which no table exercises, and exits with 1 if any contact
+		they make is wrong.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Physics.h"
+#include "PhysicsAux.h"
+#include "SimdVector.h"
+#include "TableSetup.h"
+
+using Physics::Engine;
+using Physics::BodyStore;
+using namespace TableSetup;
+
+namespace
+{
+	const int  kStepsToRack	= 90;		///< The struck cue ball is just short of the rack.
+
+	/// One case: the samples of every repetition, in the case's unit.
+	struct Result
+	{
+		std::string				mName;
+		const char*				mUnit;
+		uint32_t				mBodies;
+		std::vector< double >	mSamples;
+
+		double Median(void) const
+		{
+			std::vector< double > s(mSamples);
+			std::sort(s.begin(), s.end());
+			size_t n = s.size();
+			return n % 2 ? s[n / 2] : .5 * (s[n / 2 - 1] + s[n / 2]);
+		}
+		double Min(void) const	{ return *std::min_element(mSamples.begin(), mSamples.end()); }
+		double Max(void) const	{ return *std::max_element(mSamples.begin(), mSamples.end()); }
+		double Mean(void) const
+		{
+			double sum = 0.;
+			for(size_t i = 0; i < mSamples.size(); ++i)
+				sum += mSamples[i];
+			return sum / mSamples.size();
+		}
+	};
+
+	struct Options
+	{
+		Options() : mFormat("json"), mOut(0), mLabel(""), mReps(0), mWorkers(1), mMaxSpheres(10000), mQuick(false) {}
+		const char*	mFormat;
+		const char*	mOut;
+		const char*	mLabel;
+		int			mReps;			///< 0 picks per case.
+		unsigned	mWorkers;
+		int			mMaxSpheres;
+		bool		mQuick;
+	};
+
+	Engine* NewEngine(const Options &opts, const Physics::Params &params = Physics::Params())
+	{
+		Engine* e = new Engine(params);
+		e->SetWorkerCount(opts.mWorkers);
+		return e;
+	}
+
+	/*!
+	 @param e
+	 @return The cue ball.
+
+	 The 18-ball game's five-level pyramid of 35 object balls, placed the
+	 way Playfield::RackBalls places them, and the cue ball at rest.
+	*//*__________________________________________________________________________*/
+	uint32_t BuildRack18(Engine &e)
+	{
+		AddTable(e);
+		std::vector< Vector3D > balls;
+		Rack18(balls);
+		uint32_t cue = AddBall(e, Vector3D(0, 0, -25), Vector3D());
+		for(size_t i = 0; i < balls.size(); ++i)
+			AddBall(e, balls[i], Vector3D());
+		return cue;
+	}
+
+	/*!
+	 @param e
+	 @return The cue ball.
+
+	 The 19-ball diamond, placed the way Playfield::RackBalls places it,
+	 and the cue ball at rest.
+	*//*__________________________________________________________________________*/
+	uint32_t BuildRack19(Engine &e)
+	{
+		AddTable(e);
+		std::vector< Vector3D > pos;
+		Rack19(pos);
+		uint32_t cue = AddBall(e, Vector3D(0, 0, -25), Vector3D());
+		for(size_t i = 0; i < pos.size(); ++i)
+			AddBall(e, pos[i], Vector3D());
+		return cue;
+	}
+
+	typedef uint32_t (*RackFn)(Engine &);
+
+	/// Strikes the cue ball down the long axis, as the benchmarks always have.
+	void Strike(Engine &e, uint32_t cue)
+	{
+		e.Disturb();
+		e.RigidBodyVector3D(cue, Engine::propVeloctity, Vector3D(.05f, .02f, 1.f) * 50.f);
+	}
+
+	/*!
+	 @param name
+	 @param opts
+	 @param rack	Builds the rack and returns the cue ball.
+	 @param steps	Substeps timed per repetition, starting as the cue ball
+					reaches the rack.
+	*//*__________________________________________________________________________*/
+	Result SimulateRack(const char *name, const Options &opts, RackFn rack, int steps)
+	{
+		Result r = { name, "ms", 0, std::vector< double >() };
+		int reps = opts.mReps ? opts.mReps : (opts.mQuick ? 3 : 10);
+		for(int rep = 0; rep < reps; ++rep)
+		{
+			Engine* e = NewEngine(opts);
+			Strike(*e, rack(*e));
+			ReserveContacts(*e);
+			r.mBodies = e->mAuxEngine->mBodies.Count();
+			for(int i = 0; i < kStepsToRack; ++i)
+				e->Simulate(kSubstep);
+			Clock::time_point t0 = Clock::now();
+			for(int i = 0; i < steps; ++i)
+				e->Simulate(kSubstep);
+			r.mSamples.push_back(Millis(t0, Clock::now()) / steps);
+			delete e;
+		}
+		return r;
+	}
+
+	/*!
+	 @param opts
+	 @param count	Number of spheres.
+	*//*__________________________________________________________________________*/
+	Result SimulateField(const Options &opts, int count)
+	{
+		char name[32];
+		std::sprintf(name, "simulate/field%d", count);
+		Result r = { name, "ms", 0, std::vector< double >() };
+		int reps = opts.mReps ? opts.mReps : (opts.mQuick ? 2 : (count > 2000 ? 3 : 5));
+		int steps = count > 2000 ? 5 : 20;
+		for(int rep = 0; rep < reps; ++rep)
+		{
+			Engine* e = NewEngine(opts);
+			BuildField(*e, count);
+			ReserveContacts(*e);
+			r.mBodies = e->mAuxEngine->mBodies.Count();
+			Clock::time_point t0 = Clock::now();
+			for(int i = 0; i < steps; ++i)
+				e->Simulate(kSubstep);
+			r.mSamples.push_back(Millis(t0, Clock::now()) / steps);
+			delete e;
+		}
+		return r;
+	}
+
+	/*!
+	 @param e
+	 @param grid	Quads along each side of a wall.
+
+	 Lines the six walls of the standard table with grid x grid quads of
+	 two triangles each, facing in, as a custom table with many facets
+	 would be built.
+	*//*__________________________________________________________________________*/
+	void AddFacets(Engine &e, int grid)
+	{
+		const Real half[3] = { kHalfWidth, kHalfHeight, kHalfDepth };
+		for(int axis = 0; axis < 3; ++axis)
+			for(int side = -1; side <= 1; side += 2)
+			{
+				int u = (axis + 1) % 3, v = (axis + 2) % 3;
+				for(int i = 0; i < grid; ++i)
+					for(int j = 0; j < grid; ++j)
+					{
+						Geometry::Point3D corner[4];
+						for(int c = 0; c < 4; ++c)
+						{
+							Real at[3];
+							at[axis]	= side * half[axis];
+							at[u]		= half[u] * (-1.f + 2.f * (i + (c & 1)) / grid);
+							at[v]		= half[v] * (-1.f + 2.f * (j + (c >> 1)) / grid);
+							corner[c] = Geometry::Point3D(at[0], at[1], at[2]);
+						}
+						for(int t = 0; t < 2; ++t)
+						{
+							Physics::BoundedPlane bp(corner[0], corner[1 + 2 * t], corner[3 - t]);
+							if(Geometry::Distance(Geometry::Point3D(0, 0, 0), bp.mPlane) < 0)
+								bp = Physics::BoundedPlane(corner[0], corner[3 - t], corner[1 + 2 * t]);
+							uint32_t id = e.AddRigidBodyBoundedPlane(bp);
+							e.RigidBodyBool(id, Engine::propCollidable, true);
+							e.RigidBodyBool(id, Engine::propActive, true);
+						}
+					}
+			}
+	}
+
+	/*!
+	 @param opts
+	 @param grid	See AddFacets().
+
+	 The 100 sphere field inside a table lined with facets.
+	*//*__________________________________________________________________________*/
+	Result SimulateFacets(const Options &opts, int grid)
+	{
+		char name[32];
+		std::sprintf(name, "simulate/facets%d", 12 * grid * grid);
+		Result r = { name, "ms", 0, std::vector< double >() };
+		int reps = opts.mReps ? opts.mReps : (opts.mQuick ? 2 : 5);
+		for(int rep = 0; rep < reps; ++rep)
+		{
+			Engine* e = NewEngine(opts);
+			BuildField(*e, 100);
+			AddFacets(*e, grid);
+			ReserveContacts(*e);
+			r.mBodies = e->mAuxEngine->mBodies.Count();
+			Clock::time_point t0 = Clock::now();
+			for(int i = 0; i < 20; ++i)
+				e->Simulate(kSubstep);
+			r.mSamples.push_back(Millis(t0, Clock::now()) / 20);
+			delete e;
+		}
+		return r;
+	}
+
+	/*!
+	 @param name
+	 @param opts
+	 @param rack	Builds the rack and returns the cue ball.
+	 @param params	Tuning to break with.
+
+	 Wall time of one break shot, stepped with Update() until AtRest().
+	 Reports the frames and substeps the last repetition took.
+	*//*__________________________________________________________________________*/
+	Result BreakToRest(const char *name, const Options &opts, RackFn rack, const Physics::Params &params = Physics::Params())
+	{
+		int frames = 0;
+		Result r = { name, "ms", 0, std::vector< double >() };
+		int reps = opts.mReps ? opts.mReps : (opts.mQuick ? 2 : 5);
+		for(int rep = 0; rep < reps; ++rep)
+		{
+			Engine* e = NewEngine(opts, params);
+			uint32_t cue = rack(*e);
+			r.mBodies = e->mAuxEngine->mBodies.Count();
+			Clock::time_point t0 = Clock::now();
+			Strike(*e, cue);
+			for(frames = 0; !e->AtRest() && frames < kMaxFrames; ++frames)
+				e->Update(kFrameTime, kSubsteps);
+			r.mSamples.push_back(Millis(t0, Clock::now()));
+			delete e;
+		}
+		// Simulate() splits each of a frame's substeps into steps no longer than mMinTimeStep
+		int split = 1 + (int)(kSubstep / params.mMinTimeStep);
+		std::fprintf(stderr, "physsuite: %s came to rest after %d frames, %d substeps\n", name, frames, frames * kSubsteps * split);
+		return r;
+	}
+
+	/*!
+	 @param e
+	 @param count	Springs to make.
+	 @return The bodies, in the order they were made.
+
+	 A row of loose spheres with no collision, so that the springs are the
+	 cost: each joined to the next and to the seventh after it.
+	*//*__________________________________________________________________________*/
+	std::vector< uint32_t > BuildSprings(Engine &e, int count)
+	{
+		const int kReach = 7;
+		int balls = count / 2 + kReach;
+		Lcg rng(4321u);
+		std::vector< uint32_t > ids;
+		for(int i = 0; i < balls; ++i)
+		{
+			uint32_t id = e.AddRigidBodySphere(kBallRadius);
+			e.RigidBodyBool(id, Engine::propActive, true);
+			e.RigidBodyBool(id, Engine::propTranslatable, true);
+			e.RigidBodyScalar(id, Engine::propMass, .5f);
+			e.RigidBodyVector3D(id, Engine::propPosition, Vector3D(2.f * i + rng.Range(-.5f, .5f), rng.Range(-.5f, .5f), rng.Range(-.5f, .5f)));
+			e.RigidBodyVector3D(id, Engine::propVeloctity, Vector3D(rng.Range(-5.f, 5.f), rng.Range(-5.f, 5.f), rng.Range(-5.f, 5.f)));
+			ids.push_back(id);
+		}
+		for(int made = 0, i = 0; made < count; ++i)
+		{
+			for(int link = 1; link <= kReach && made < count; link += kReach - 1, ++made)
+			{
+				uint32_t k = e.AddSpring();
+				e.SpringBody(k, Engine::propBody1, ids[i]);
+				e.SpringBody(k, Engine::propBody2, ids[i + link]);
+				e.SpringScalar(k, Engine::propSpringStiffness, 4.f);
+				e.SpringScalar(k, Engine::propSpringDamping, .3f);
+				e.SpringScalar(k, Engine::propSpringRestLength, 2.f * link);
+				e.SpringBool(k, Engine::propSpringCompressible, link == 1);
+			}
+		}
+		return ids;
+	}
+
+	/*!
+	 @param opts
+	 @param count	Springs in the scene.
+	 @param results	Receives simulate/springsN, one substep, and
+					remove/springsN, removing every tenth body with its
+					springs.
+	*//*__________________________________________________________________________*/
+	void SimulateSprings(const Options &opts, int count, std::vector< Result > &results)
+	{
+		char name[32];
+		std::sprintf(name, "simulate/springs%d", count);
+		Result step = { name, "ms", 0, std::vector< double >() };
+		std::sprintf(name, "remove/springs%d", count);
+		Result remove = { name, "ms", 0, std::vector< double >() };
+		int reps = opts.mReps ? opts.mReps : (opts.mQuick ? 2 : 5);
+		const int steps = 20;
+		for(int rep = 0; rep < reps; ++rep)
+		{
+			Engine* e = NewEngine(opts);
+			std::vector< uint32_t > ids = BuildSprings(*e, count);
+			step.mBodies = remove.mBodies = e->mAuxEngine->mBodies.Count();
+			Clock::time_point t0 = Clock::now();
+			for(int i = 0; i < steps; ++i)
+				e->Simulate(kSubstep);
+			step.mSamples.push_back(Millis(t0, Clock::now()) / steps);
+
+			t0 = Clock::now();
+			for(size_t i = 0; i < ids.size(); i += 10)
+				e->RemoveRigidBody(ids[i]);
+			remove.mSamples.push_back(Millis(t0, Clock::now()));
+			delete e;
+		}
+		results.push_back(step);
+		results.push_back(remove);
+	}
+
+	/// What Resolve() changes on a body, so a contact can be resolved again.
+	struct BodyState
+	{
+		explicit BodyState(Physics::RigidBody* body) : mBody(body),
+			mPosition(body->PositionT1()), mVelocity(body->VelocityT1()), mAngMomentum(body->AngularMomentumT1()) {}
+		void Restore(void) const
+		{
+			mBody->PositionT1()			= mPosition;
+			mBody->VelocityT1()			= mVelocity;
+			mBody->AngularMomentumT1()	= mAngMomentum;
+		}
+		Physics::RigidBody*	mBody;
+		Vector3D			mPosition, mVelocity, mAngMomentum;
+	};
+
+	/*!
+	 @param opts
+	 @param results	The collide/... and resolve/... cases are appended.
+
+	 A sphere pair that overlaps and closes, and a sphere crossing the top
+	 wall, in a table with no other balls: every test finds a contact.
+	*//*__________________________________________________________________________*/
+	void CollideAndResolve(const Options &opts, std::vector< Result > &results)
+	{
+		const int iterations = opts.mQuick ? 20000 : 200000;
+		int reps = opts.mReps ? opts.mReps : (opts.mQuick ? 3 : 7);
+
+		Engine* e = NewEngine(opts);
+		AddTable(*e);
+		BodyStore &bodies = e->mAuxEngine->mBodies;
+		Collision::Engine &collide = e->mAuxEngine->mCollisionEngine;
+		Physics::RigidBody* a = bodies.Lookup(AddBall(*e, Vector3D(0, 0, 0), Vector3D()));
+		Physics::RigidBody* b = bodies.Lookup(AddBall(*e, Vector3D(0, 0, 0), Vector3D()));
+		Physics::RigidBody* c = bodies.Lookup(AddBall(*e, Vector3D(0, 0, 0), Vector3D()));
+		Physics::RigidBody* wall = bodies.Body(0);
+		uint32_t count = bodies.Count();
+
+		a->PositionT0() = Vector3D(0, 0, 0);		a->PositionT1() = Vector3D(0, 0, .1f);
+		b->PositionT0() = Vector3D(0, 0, 1.9f);		b->PositionT1() = Vector3D(0, 0, 1.9f);
+		a->VelocityT1() = Vector3D(0, 0, 10.f);
+		Vector3D n = ((Physics::Plane*)wall->mCollideGeom)->mPlane.normal();
+		c->PositionT0() = (-kHalfHeight + 1.5f) * n;
+		c->PositionT1() = (-kHalfHeight + .5f) * n;
+		c->VelocityT1() = -100.f * n;
+
+		Physics::RigidBody* pairs[2][2] = { { a, b }, { wall, c } };
+		const char* names[2] = { "sphere_sphere", "plane_sphere" };
+		for(int p = 0; p < 2; ++p)
+		{
+			Physics::RigidBody* body1 = pairs[p][0];
+			Physics::RigidBody* body2 = pairs[p][1];
+			Result test = { std::string("collide/") + names[p], "ns", count, std::vector< double >() };
+			Result resolve = { std::string("resolve/") + names[p], "ns", count, std::vector< double >() };
+
+			// one contact to resolve over and over
+			Collision::Contact saved;
+			Collision::Contact* found = collide.TestCollision(body1, body2);
+			if(found)
+				saved = *found;
+			collide.End();
+			if(!found)
+			{
+				std::fprintf(stderr, "physsuite: %s found no contact\n", names[p]);
+				continue;
+			}
+			BodyState state1(body1), state2(body2);
+
+			for(int rep = 0; rep < reps; ++rep)
+			{
+				Clock::time_point t0 = Clock::now();
+				for(int i = 0; i < iterations; ++i)
+				{
+					collide.TestCollision(body1, body2);
+					collide.End();
+				}
+				test.mSamples.push_back(1.e6 * Millis(t0, Clock::now()) / iterations);
+
+				Collision::Contact contact;
+				t0 = Clock::now();
+				for(int i = 0; i < iterations; ++i)
+				{
+					contact = saved;
+					state1.Restore();
+					state2.Restore();
+					collide.Resolve(&contact);
+				}
+				resolve.mSamples.push_back(1.e6 * Millis(t0, Clock::now()) / iterations);
+			}
+			state1.Restore();
+			state2.Restore();
+			results.push_back(test);
+			results.push_back(resolve);
+		}
+		delete e;
+	}
+
+	/// A sphere meeting a shape over one step, and the contact it should make.
+	struct ShapeCase
+	{
+		const char*	mName;
+		int			mShape;		///< Index into the shapes CheckShapes() builds.
+		Vector3D	mFrom;		///< The sphere's centre at the start of the step...
+		Vector3D	mTo;		///< ...and at the end.
+		bool		mHit;
+		Vector3D	mNormal;	///< From the shape to the sphere.
+		Real		mDepth;
+	};
+
+	bool Near(const Vector3D &a, const Vector3D &b)
+	{
+		return (Real)(a - b).length() < 1.e-4f;
+	}
+
+	/*!
+	 @param e
+	 @param c
+	 @param shape	The shape's body.
+	 @param ball	A sphere of kBallRadius.
+	 @return The number of checks that failed.
+
+	 Tests the pair both ways round, as (shape, sphere) and (sphere, shape),
+	 and checks the contact names the shape first, with the normal and
+	 depth expected; then resolves it and checks the sphere leaves the
+	 shape and the shape stays put.
+	*//*__________________________________________________________________________*/
+	int CheckShapeCase(Engine &e, const ShapeCase &c, uint32_t shape, uint32_t ball)
+	{
+		BodyStore &bodies = e.mAuxEngine->mBodies;
+		Collision::Engine &collide = e.mAuxEngine->mCollisionEngine;
+		Physics::RigidBody* s = bodies.Lookup(shape);
+		Physics::RigidBody* b = bodies.Lookup(ball);
+		Vector3D at = s->PositionT1();
+
+		int failed = 0;
+		for(int swap = 0; swap < 2; ++swap)
+		{
+			const char* order = swap ? "sphere first" : "shape first";
+			b->PositionT0() = c.mFrom;
+			b->PositionT1() = c.mTo;
+			b->VelocityT1() = 10.f * (c.mTo - c.mFrom).normal();
+			b->AngularMomentumT1() = Vector3D();
+
+			Collision::Contact* found = swap ? collide.TestCollision(b, s) : collide.TestCollision(s, b);
+			const char* wrong = 0;
+			if(!found != !c.mHit)
+				wrong = c.mHit ? "found no contact" : "found a contact";
+			else if(!found)
+				;
+			else if(found->mID1 != shape || found->mID2 != ball)
+				wrong = "named the bodies in the wrong order";
+			else if(!Near(found->mNormal, c.mNormal))
+				wrong = "has the wrong normal";
+			else if(Math::Abs(found->mDepth - c.mDepth) > 1.e-4f)
+				wrong = "has the wrong depth";
+			else
+			{
+				Collision::Contact contact = *found;
+				collide.Resolve(&contact);
+				if((Real)(b->VelocityT1() * c.mNormal) <= k0)
+					wrong = "still moves into the shape once resolved";
+				else if(!Near(s->PositionT1(), at) || !Near(s->VelocityT1(), Vector3D()))
+					wrong = "moved the shape";
+			}
+			collide.End();
+			if(wrong)
+			{
+				std::fprintf(stderr, "physsuite: %s, %s: %s\n", c.mName, order, wrong);
+				++failed;
+			}
+		}
+		return failed;
+	}
+
+	uint32_t AddCapsule(Engine &e)
+	{
+		return e.AddRigidBodyCapsule(3.f, .5f);
+	}
+
+	uint32_t AddBox(Engine &e)
+	{
+		return e.AddRigidBodyBox(Vector3D(2.f, 1.f, 3.f));
+	}
+
+	/// A cube 4 across with one edge cut off at 45 degrees.
+	uint32_t AddHull(Engine &e)
+	{
+		Physics::ConvexHull hull;
+		for(int axis = 0; axis < 3; ++axis)
+			for(int side = -1; side <= 1; side += 2)
+			{
+				Vector3D n;
+				n[axis] = (Real)side;
+				hull.AddFace(n, 2.f);
+			}
+		hull.AddFace(Vector3D(1, 1, 0), 2.f);
+		return e.AddRigidBodyConvexHull(hull);
+	}
+
+	typedef uint32_t (*ShapeFn)(Engine &);
+
+	/*!
+	 @param opts
+	 @return The number of checks that failed.
+
+	 The capsule, box and convex hull pairs with a sphere, which no table
+	 uses: a contact from each side of each shape, in both pair orders,
+	 a near miss, and a sphere thrown at each shape through Simulate(),
+	 which must stop it at the surface: a bounding radius that is too small
+	 lets it in deep before the shape is even tested. Also checks a hull's bounding radius is taken
+	 from its faces and that open and empty hulls are refused.
+	*//*__________________________________________________________________________*/
+	int CheckShapes(const Options &opts)
+	{
+		const ShapeFn shapes[3] = { AddCapsule, AddBox, AddHull };
+		const Real r2 = std::sqrt(.5f);
+		const Vector3D cut(r2, r2, 0);
+		const ShapeCase cases[] =
+		{
+			{ "capsule_sphere/side",	0, Vector3D(0, 4, 1),			Vector3D(0, 1.3f, 1),			true,	Vector3D(0, 1, 0),		.2f },
+			{ "capsule_sphere/end",		0, Vector3D(0, 0, 7),			Vector3D(0, 0, 4.2f),			true,	Vector3D(0, 0, 1),		.3f },
+			{ "capsule_sphere/miss",	0, Vector3D(0, 4, 1),			Vector3D(0, 1.6f, 1),			false,	Vector3D(),				0 },
+			{ "box_sphere/face",		1, Vector3D(5, 0, 0),			Vector3D(2.5f, 0, 0),			true,	Vector3D(1, 0, 0),		.5f },
+			{ "box_sphere/edge",		1, Vector3D(4.1f, 3.8f, 0),		Vector3D(2.3f, 1.4f, 0),		true,	Vector3D(.6f, .8f, 0),	.5f },
+			{ "box_sphere/inside",		1, Vector3D(0, 3, 0),			Vector3D(0, .8f, 0),			true,	Vector3D(0, 1, 0),		1.2f },
+			{ "box_sphere/miss",		1, Vector3D(4.1f, 3.8f, 0),		Vector3D(2.6f, 1.8f, 0),		false,	Vector3D(),				0 },
+			{ "hull_sphere/cut",		2, 6.f * cut,					2.6f * cut,						true,	cut,					.4f },
+			{ "hull_sphere/face",		2, Vector3D(0, 0, -6),			Vector3D(0, 0, -2.7f),			true,	Vector3D(0, 0, -1),		.3f },
+			{ "hull_sphere/miss",		2, Vector3D(0, 0, -6),			Vector3D(0, 0, -3.1f),			false,	Vector3D(),				0 },
+		};
+		const int count = sizeof(cases) / sizeof(cases[0]);
+
+		int failed = 0;
+		Engine* e = NewEngine(opts);
+		uint32_t ids[3];
+		for(int i = 0; i < 3; ++i)
+			ids[i] = shapes[i](*e);
+		uint32_t ball = AddBall(*e, Vector3D(), Vector3D());
+		for(int i = 0; i < count; ++i)
+			failed += CheckShapeCase(*e, cases[i], ids[cases[i].mShape], ball);
+
+		Real bound = e->mAuxEngine->mBodies.Lookup(ids[2])->mCollideGeom->Bound();
+		if(Math::Abs(bound - std::sqrt(12.f)) > 1.e-4f)
+		{
+			std::fprintf(stderr, "physsuite: hull bound is %g, not %g\n", bound, std::sqrt(12.f));
+			++failed;
+		}
+		Physics::ConvexHull open, empty;
+		for(int axis = 0; axis < 2; ++axis)
+			for(int side = -1; side <= 1; side += 2)
+			{
+				Vector3D n;
+				n[axis] = (Real)side;
+				open.AddFace(n, 2.f);
+			}
+		empty = open;
+		empty.AddFace(Vector3D(0, 0, 1), -1.f);
+		empty.AddFace(Vector3D(0, 0, -1), -1.f);
+		if(e->AddRigidBodyConvexHull(open) != BodyStore::kInvalid || e->AddRigidBodyConvexHull(empty) != BodyStore::kInvalid)
+		{
+			std::fprintf(stderr, "physsuite: an open or empty hull was not refused\n");
+			++failed;
+		}
+		delete e;
+
+		// the first case of each shape again, but found by the engine itself
+		for(int i = 0; i < count; ++i)
+		{
+			if(i > 0 && cases[i].mShape == cases[i - 1].mShape)
+				continue;
+			const ShapeCase &c = cases[i];
+			Engine* world = NewEngine(opts);
+			uint32_t id = shapes[c.mShape](*world);
+			world->RigidBodyBool(id, Engine::propCollidable, true);
+			world->RigidBodyBool(id, Engine::propActive, true);
+			uint32_t b = AddBall(*world, c.mTo + 4.f * c.mNormal, -20.f * c.mNormal);
+			world->RigidBodyBool(b, Engine::propUseGravity, false);
+			world->Disturb();
+			// the sphere moves .2 a step, so it should never get further than that into the shape
+			Vector3D to = c.mTo;
+			Real surface = (Real)(to * c.mNormal) + c.mDepth - kBallRadius;
+			Real closest = kMax;
+			for(int step = 0; step < 50; ++step)
+			{
+				world->Simulate(kSubstep);
+				closest = std::min(closest, (Real)(world->RigidBodyVector3D(b, Engine::propPosition) * c.mNormal) - surface);
+			}
+			if(closest < .5f * kBallRadius || (Real)(world->RigidBodyVector3D(b, Engine::propVeloctity) * c.mNormal) <= k0)
+			{
+				std::fprintf(stderr, "physsuite: %s: Simulate() let the sphere %g into the shape\n", c.mName, kBallRadius - closest);
+				++failed;
+			}
+			delete world;
+		}
+		std::fprintf(stderr, "physsuite: shape checks %s\n", failed ? "FAILED" : "passed");
+		return failed;
+	}
+
+	const char* SimdName(void)
+	{
+#if defined( __AVX2__ ) && defined( CH_SIMD_SSE2 )
+		return "avx2";
+#elif defined( CH_SIMD_SSE2 )
+		return "sse2";
+#else
+		return "none";
+#endif
+	}
+
+	void CompilerName(char *out, size_t size)
+	{
+#if defined( _MSC_VER )
+		std::snprintf(out, size, "msvc %d", _MSC_VER);
+#elif defined( __clang__ )
+		std::snprintf(out, size, "clang %d.%d.%d", __clang_major__, __clang_minor__, __clang_patchlevel__);
+#elif defined( __GNUC__ )
+		std::snprintf(out, size, "gcc %d.%d.%d", __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__);
+#else
+		std::snprintf(out, size, "unknown");
+#endif
+	}
+
+	/// Names and labels are plain ASCII; only quotes and backslashes need escaping.
+	std::string Quote(const char *s)
+	{
+		std::string out("\"");
+		for(; *s; ++s)
+		{
+			if(*s == '"' || *s == '\\')
+				out += '\\';
+			out += *s;
+		}
+		return out + "\"";
+	}
+
+	void WriteJson(FILE *f, const Options &opts, const std::vector< Result > &results)
+	{
+		char compiler[64];
+		CompilerName(compiler, sizeof(compiler));
+		std::fprintf(f, "{\n  \"suite\": \"physsuite\",\n  \"version\": 1,\n");
+		std::fprintf(f, "  \"label\": %s,\n", Quote(opts.mLabel).c_str());
+		std::fprintf(f, "  \"compiler\": %s,\n  \"simd\": \"%s\",\n  \"workers\": %u,\n  \"quick\": %s,\n",
+			Quote(compiler).c_str(), SimdName(), opts.mWorkers, opts.mQuick ? "true" : "false");
+		std::fprintf(f, "  \"results\": [\n");
+		for(size_t i = 0; i < results.size(); ++i)
+		{
+			const Result &r = results[i];
+			std::fprintf(f, "    { \"name\": %s, \"unit\": \"%s\", \"bodies\": %u, \"reps\": %u, "
+				"\"median\": %.6g, \"min\": %.6g, \"max\": %.6g, \"mean\": %.6g }%s\n",
+				Quote(r.mName.c_str()).c_str(), r.mUnit, r.mBodies, (unsigned)r.mSamples.size(),
+				r.Median(), r.Min(), r.Max(), r.Mean(), i + 1 < results.size() ? "," : "");
+		}
+		std::fprintf(f, "  ]\n}\n");
+	}
+
+	void WriteCsv(FILE *f, const std::vector< Result > &results)
+	{
+		std::fprintf(f, "name,unit,bodies,reps,median,min,max,mean\n");
+		for(size_t i = 0; i < results.size(); ++i)
+		{
+			const Result &r = results[i];
+			std::fprintf(f, "%s,%s,%u,%u,%.6g,%.6g,%.6g,%.6g\n", r.mName.c_str(), r.mUnit, r.mBodies,
+				(unsigned)r.mSamples.size(), r.Median(), r.Min(), r.Max(), r.Mean());
+		}
+	}
+
+	bool ParseArgs(int argc, char **argv, Options &opts)
+	{
+		for(int i = 1; i < argc; ++i)
+		{
+			std::string arg(argv[i]);
+			bool hasValue = i + 1 < argc;
+			if(arg == "--quick")
+				opts.mQuick = true;
+			else if(arg == "--format" && hasValue)
+				opts.mFormat = argv[++i];
+			else if(arg == "--out" && hasValue)
+				opts.mOut = argv[++i];
+			else if(arg == "--label" && hasValue)
+				opts.mLabel = argv[++i];
+			else if(arg == "--reps" && hasValue)
+				opts.mReps = std::max(1, std::atoi(argv[++i]));
+			else if(arg == "--workers" && hasValue)
+				opts.mWorkers = (unsigned)std::atoi(argv[++i]);
+			else if(arg == "--max-spheres" && hasValue)
+				opts.mMaxSpheres = std::atoi(argv[++i]);
+			else
+				return false;
+		}
+		if(opts.mWorkers == 0)
+			opts.mWorkers = std::max(1u, std::thread::hardware_concurrency());
+		return std::strcmp(opts.mFormat, "json") == 0 || std::strcmp(opts.mFormat, "csv") == 0;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options opts;
+	if(!ParseArgs(argc, argv, opts))
+	{
+		std::fprintf(stderr, "usage: physsuite [--format json|csv] [--out file] [--label text]\n"
+			"                 [--reps n] [--workers n] [--max-spheres n] [--quick]\n");
+		return 2;
+	}
+	if(opts.mQuick)
+		opts.mMaxSpheres = std::min(opts.mMaxSpheres, 1000);
+
+	std::vector< Result > results;
+	results.push_back(SimulateRack("simulate/rack18", opts, BuildRack18, 200));
+	results.push_back(SimulateRack("simulate/rack19", opts, BuildRack19, 200));
+	const int fields[] = { 100, 300, 1000, 3000, 10000 };
+	for(size_t i = 0; i < sizeof(fields) / sizeof(fields[0]) && fields[i] <= opts.mMaxSpheres; ++i)
+		results.push_back(SimulateField(opts, fields[i]));
+	for(int grid = 4; grid <= 16; grid *= 2)
+		results.push_back(SimulateFacets(opts, grid));
+	for(int springs = 1000; springs <= 10 * opts.mMaxSpheres && springs <= 100000; springs *= 10)
+		SimulateSprings(opts, springs, results);
+
+	CollideAndResolve(opts, results);
+	int failed = CheckShapes(opts);
+
+	Physics::Params solver;
+	solver.mSolverIterations = 8;
+	Physics::Params solverLong = solver;
+	solverLong.mMinTimeStep = 1.f / 400.f;
+	results.push_back(BreakToRest("break/rack18", opts, BuildRack18));
+	results.push_back(BreakToRest("break/rack19", opts, BuildRack19));
+	results.push_back(BreakToRest("break/rack18_solver", opts, BuildRack18, solver));
+	results.push_back(BreakToRest("break/rack19_solver", opts, BuildRack19, solver));
+	results.push_back(BreakToRest("break/rack19_solver_long", opts, BuildRack19, solverLong));
+
+	FILE *f = opts.mOut ? std::fopen(opts.mOut, "w") : stdout;
+	if(!f)
+	{
+		std::fprintf(stderr, "physsuite: cannot write %s\n", opts.mOut);
+		return 1;
+	}
+	if(std::strcmp(opts.mFormat, "csv") == 0)
+		WriteCsv(f, results);
+	else
+		WriteJson(f, opts, results);
+	if(f != stdout)
+		std::fclose(f);
+	return failed ? 1 : 0;
+}
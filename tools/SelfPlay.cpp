@@ -0,0 +1,490 @@
+/*!
+	@file	SelfPlay.cpp
+	@date	October 17, 2026
+
+	@brief	Plays the AI against itself without a window and logs every shot.
+
+		Usage: selfplay --out file [--games n] [--rack 18|19|both] [--net file|none]
+		                [--explore e] [--shots n] [--workers n] [--seed n] [--search ms]
+
+		Each game racks a table the way Playfield::RackBalls does (--rack,
+		default both: the 18- and 19-ball games by turns), breaks, and then
+		shoots until the table is clear or --shots (default 60) have been
+		taken. Every shot is chosen the way AIPlayer::SelectShot chooses
+		one: each object ball left is paired with each pocket, the pair's
+		features (see ShotFeatures.h) are scored by the net, and the best
+		is aimed at its ghost ball, perturbed as SelectShot perturbs it, and
+		struck at the power the game gives the AI. With --search, the net's
+		best few are instead played out for up to that many milliseconds
+		by a ShotSearch, as AIPlayer does when it is given time to think,
+		and the best of them is struck unperturbed. One shot in --explore
+		(default .1) is picked at random instead so the log is not only the
+		net's favourites; with --net none every shot is.
+
+		The table is stepped as the game steps it until it comes to rest.
+		The chosen shot's features are then written to --out with 1 if the
+		object ball dropped into the pocket aimed at, else 0 (see
+		ShotLog.h). Pocketed balls leave the table; a pocketed cue ball is
+		spotted again. No game rules are played: every object ball on the
+		table is a legal target.
+
+		Games run --workers at a time (default one per core), each on its
+		own engine, and are written in game order; each game's random
+		numbers come from --seed and its number alone, so a seed always
+		makes the same log whatever the worker count. A --search log also
+		depends on how many shots the search finished in time, so it is
+		only the same from run to run if every search finishes.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Physics.h"
+#include "JobPool.h"
+#include "ShotPlanner.h"
+#include "ShotSearch.h"
+#include "ShotLog.h"
+#include "TableSetup.h"
+
+using Physics::Engine;
+using namespace TableSetup;
+
+namespace
+{
+	const Real kPower		= 60.f;		///< What the game strikes the AI's aim with.
+	const uint32_t kGamesPerWorker = 4;	///< Games held in memory per worker before writing.
+
+	struct Options
+	{
+		Options() : mOut(0), mGames(100), mRack(0), mNet("data/AIPlayer.bpn"), mExplore(.1f), mShots(60),
+			mWorkers(0), mSeed(1), mSearch(0.f) {}
+		const char*	mOut;
+		uint32_t	mGames;
+		int			mRack;			///< 18, 19, or 0 for both.
+		const char*	mNet;			///< 0 for no net.
+		float		mExplore;
+		int			mShots;
+		unsigned	mWorkers;
+		uint32_t	mSeed;
+		float		mSearch;		///< Milliseconds ShotSearch gets per shot; 0 for none.
+	};
+
+	/// What one game did; summed over all of them for the report.
+	struct GameStats
+	{
+		GameStats() : mShots(0), mMade(0), mScratches(0), mFrames(0), mCleared(0) {}
+		uint64_t	mShots;
+		uint64_t	mMade;			///< Shots that dropped the ball aimed at in the pocket aimed at.
+		uint64_t	mScratches;
+		uint64_t	mFrames;
+		uint64_t	mCleared;		///< Games that ran out of object balls.
+
+		void Add(const GameStats &rhs)
+		{
+			mShots		+= rhs.mShots;
+			mMade		+= rhs.mMade;
+			mScratches	+= rhs.mScratches;
+			mFrames		+= rhs.mFrames;
+			mCleared	+= rhs.mCleared;
+		}
+	};
+
+	/// A ball and the pocket it went into.
+	struct Drop
+	{
+		uint32_t	mBall;
+		uint32_t	mPocket;
+	};
+	/// Where OnPocket() records: the match this thread is playing points it at its own drops.
+	thread_local std::vector< Drop >* tDrops = 0;
+
+	void OnPocket(Collision::Contact* c, Physics::RigidBody*, Physics::RigidBody*)
+	{
+		// mID1 is the pocket's plane; a ball touches it for a few steps but drops once
+		for(size_t i = 0; i < tDrops->size(); ++i)
+		{
+			if((*tDrops)[i].mBall == c->mID2)
+				return;
+		}
+		Drop drop = { c->mID2, c->mID1 };
+		tDrops->push_back(drop);
+	}
+
+	/*!
+	 @brief	One game on its own engine, from the rack until the table is clear.
+	*//*__________________________________________________________________________*/
+	class Match
+	{
+	public:
+		Match(const Options &opts, const AI::NeuralNet* net, uint32_t index);
+		~Match()	{ delete mNet; }
+
+		void	Play(std::vector< float > &records, GameStats &stats);
+
+	private:
+		Geometry::Point3D	Position(uint32_t id)
+		{
+			Vector3D p = mEngine.RigidBodyVector3D(id, Engine::propPosition);
+			return Geometry::Point3D(p[0], p[1], p[2]);
+		}
+		int		Choose(uint32_t &ball, uint32_t &pocket, Vector3D &aim, float &power, Vector3D &spin);
+		void	Perturb(Vector3D &v, float score);
+		void	Shoot(const Vector3D &velocity, const Vector3D &spin, GameStats &stats);
+		void	Clear(GameStats &stats);
+		void	Spot(void);
+
+		// disabled
+		Match(const Match &);
+		Match& operator=(const Match &);
+
+		const Options&			mOpts;
+		Lcg						mRng;
+		Engine					mEngine;
+		AI::NeuralNet*			mNet;			///< Own copy, since running it uses its scratch; 0 for none.
+		Pockets					mPockets;
+		uint32_t				mCue;
+		std::vector< uint32_t >	mBalls;			///< Object balls still on the table.
+		std::vector< Drop >		mDrops;			///< Of the last shot.
+		AI::ShotPlanner			mPlanner;
+		AI::ShotSearch			mSearch;		///< One worker: the games are already spread over them.
+	};
+
+	/*!
+	 @param opts
+	 @param net		The net to score shots with, copied; 0 to choose at random.
+	 @param index	Which game of the run; picks the rack and the random numbers.
+	*//*__________________________________________________________________________*/
+	Match::Match(const Options &opts, const AI::NeuralNet* net, uint32_t index)
+		: mOpts(opts), mRng((opts.mSeed + index) * 2654435761u + 1), mEngine(Physics::Params()),
+		mNet(net ? new AI::NeuralNet(*net) : 0), mCue(0), mSearch(1)
+	{
+		mEngine.AddPhysicsCallback(kCollisionCBSpherePocket, OnPocket);
+		AddTable(mEngine, &mPockets);
+
+		std::vector< Vector3D > rack;
+		int kind = opts.mRack ? opts.mRack : (index % 2 ? 19 : 18);
+		if(kind == 19)
+			Rack19(rack);
+		else
+			Rack18(rack);
+		mCue = AddBall(mEngine, Vector3D(0, 0, -25));
+		for(size_t i = 0; i < rack.size(); ++i)
+			mBalls.push_back(AddBall(mEngine, rack[i]));
+	}
+
+	/*!
+	 @param ball	Receives the object ball to shoot at...
+	 @param pocket	...the index of the pocket to shoot it into...
+	 @param aim		...the cue ball's direction, normalized and perturbed...
+	 @param power	...the speed to strike it at...
+	 @param spin	...and the spin to give it.
+	 @return The chosen candidate's number in mPlanner, or -1 if there is none.
+	*//*__________________________________________________________________________*/
+	int Match::Choose(uint32_t &ball, uint32_t &pocket, Vector3D &aim, float &power, Vector3D &spin)
+	{
+		mPlanner.Clear(Position(mCue));
+		for(uint32_t b = 0; b < mBalls.size(); ++b)
+			mPlanner.AddBall(Position(mBalls[b]), true);
+		for(uint32_t p = 0; p < mPockets.mCorners.size(); ++p)
+			mPlanner.AddPocket(mPockets.mCorners[p]);
+		mPlanner.Plan(mNet);
+		const uint32_t count = mPlanner.Count();
+		if(count == 0)
+			return -1;
+
+		uint32_t best = mPlanner.Best();
+		power	= kPower;
+		spin	= Vector3D();
+		if(!mNet || mRng.Float() < mOpts.mExplore)
+			best = mRng.Below(count);
+		else if(mOpts.mSearch > 0.f)
+		{
+			AI::SearchParams params;
+			params.mBudgetMs	= mOpts.mSearch;
+			params.mPower		= kPower;
+			std::vector< uint32_t > pocketOf(mPockets.mIds.size());
+			for(uint32_t p = 0; p < pocketOf.size(); ++p)
+				pocketOf[p] = p;
+			mSearch.Start(mEngine, mPlanner, mNet, mCue, mBalls, mPockets.mIds, pocketOf, params);
+			mSearch.Run(mOpts.mSearch);
+			AI::SearchResult result = mSearch.Result();
+			if(result.mPlayed)
+			{
+				ball	= mBalls[mPlanner.Ball(result.mCandidate)];
+				pocket	= mPlanner.Pocket(result.mCandidate);
+				aim		= result.mAim;
+				power	= result.mPower;
+				spin	= result.mSpin;
+				return (int)result.mCandidate;
+			}
+		}
+		float score = mNet ? mPlanner.Score(best) : .5f;
+
+		ball	= mBalls[mPlanner.Ball(best)];
+		pocket	= mPlanner.Pocket(best);
+		aim		= mPlanner.Aim(best);
+		float len = aim.length();
+		if(len <= 0.f)
+			aim = Vector3D(0, 0, 1);
+		else
+			aim = aim * (1.f / len);
+		Perturb(aim, score);
+		return (int)best;
+	}
+
+	/*!
+	 @param v		The aim, changed in place.
+	 @param score	The net's score for the shot; the surer, the less often it is perturbed.
+
+	 As AIPlayer's Perturb(): sometimes stretches one component by a tenth.
+	*//*__________________________________________________________________________*/
+	void Match::Perturb(Vector3D &v, float score)
+	{
+		uint32_t n = 1 + mRng.Below(10);
+		float f = mRng.Float();
+		if(f > score)
+		{
+			if(n == 2)
+				v[0] *= 1.1f;
+			if(n == 3)
+				v[1] *= 1.1f;
+			if(n == 4 || n == 6)
+				v[2] *= 1.1f;
+		}
+	}
+
+	/*!
+	 @param velocity	Given to the cue ball...
+	 @param spin		...and this added to its spin.
+	 @param stats
+
+	 Steps the table as the game loop does until it comes to rest; the
+	 balls that dropped are left in mDrops.
+	*//*__________________________________________________________________________*/
+	void Match::Shoot(const Vector3D &velocity, const Vector3D &spin, GameStats &stats)
+	{
+		mDrops.clear();
+		tDrops = &mDrops;
+		mEngine.Disturb();
+		mEngine.RigidBodyVector3D(mCue, Engine::propVeloctity, velocity);
+		mEngine.RigidBodyVector3D(mCue, Engine::propAngVelocity, mEngine.RigidBodyVector3D(mCue, Engine::propAngVelocity) + spin);
+		int frames = 0;
+		for(; !mEngine.AtRest() && frames < kMaxFrames; ++frames)
+			mEngine.Update(kFrameTime, kSubsteps);
+		tDrops = 0;
+		stats.mFrames += frames;
+	}
+
+	/*!
+	 @param stats
+
+	 Takes the balls that dropped off the table, and spots the cue ball if
+	 it was one of them.
+	*//*__________________________________________________________________________*/
+	void Match::Clear(GameStats &stats)
+	{
+		for(size_t i = 0; i < mDrops.size(); ++i)
+		{
+			if(mDrops[i].mBall == mCue)
+			{
+				++stats.mScratches;
+				Spot();
+				continue;
+			}
+			std::vector< uint32_t >::iterator it = std::find(mBalls.begin(), mBalls.end(), mDrops[i].mBall);
+			if(it != mBalls.end())
+			{
+				mEngine.RemoveRigidBody(*it);
+				mBalls.erase(it);
+			}
+		}
+	}
+
+	/// Puts the cue ball back where it is racked, or behind that if a ball is in the way.
+	void Match::Spot(void)
+	{
+		Vector3D spot(0, 0, -25);
+		for(bool clear = false; !clear && spot[2] > -kHalfDepth + kBallRadius; )
+		{
+			clear = true;
+			for(size_t i = 0; i < mBalls.size() && clear; ++i)
+			{
+				Vector3D d = mEngine.RigidBodyVector3D(mBalls[i], Engine::propPosition) - spot;
+				if(d * d < 4.f * kBallRadius * kBallRadius)
+				{
+					clear = false;
+					spot[2] -= 2.f * kBallRadius;
+				}
+			}
+		}
+		mEngine.RigidBodyVector3D(mCue, Engine::propPosition, spot);
+		mEngine.RigidBodyVector3D(mCue, Engine::propVeloctity, Vector3D());
+	}
+
+	/*!
+	 @param records	Receives a log record for every shot after the break.
+	 @param stats	Receives what the game did.
+	*//*__________________________________________________________________________*/
+	void Match::Play(std::vector< float > &records, GameStats &stats)
+	{
+		// the break, down the long axis with a little jitter so no two games match
+		Vector3D brk(mRng.Range(-.03f, .03f), mRng.Range(-.03f, .03f), 1.f);
+		Shoot(brk * kPower, Vector3D(), stats);
+		Clear(stats);
+
+		for(int shot = 0; shot < mOpts.mShots && !mBalls.empty(); ++shot)
+		{
+			uint32_t ball, pocket;
+			Vector3D aim, spin;
+			float power;
+			int row = Choose(ball, pocket, aim, power, spin);
+			if(row < 0)
+				break;
+			Shoot(aim * power, spin, stats);
+
+			float made = 0.f;
+			for(size_t i = 0; i < mDrops.size(); ++i)
+			{
+				if(mDrops[i].mBall == ball && mDrops[i].mPocket == mPockets.mIds[pocket])
+					made = 1.f;
+			}
+			const float* inputs = mPlanner.Inputs(row);
+			records.insert(records.end(), inputs, inputs + AI::kShotInputs);
+			records.push_back(made);
+			++stats.mShots;
+			stats.mMade += made > 0.f;
+			Clear(stats);
+		}
+		if(mBalls.empty())
+			++stats.mCleared;
+	}
+
+	bool ParseArgs(int argc, char **argv, Options &opts)
+	{
+		for(int i = 1; i < argc; ++i)
+		{
+			std::string arg(argv[i]);
+			if(i + 1 >= argc)
+				return false;
+			const char *value = argv[++i];
+			if(arg == "--out")
+				opts.mOut = value;
+			else if(arg == "--games")
+				opts.mGames = (uint32_t)std::max(1, std::atoi(value));
+			else if(arg == "--rack" && (std::strcmp(value, "18") == 0 || std::strcmp(value, "19") == 0 || std::strcmp(value, "both") == 0))
+				opts.mRack = std::atoi(value);
+			else if(arg == "--net")
+				opts.mNet = std::strcmp(value, "none") == 0 ? 0 : value;
+			else if(arg == "--explore")
+				opts.mExplore = (float)std::atof(value);
+			else if(arg == "--shots")
+				opts.mShots = std::max(1, std::atoi(value));
+			else if(arg == "--workers")
+				opts.mWorkers = (unsigned)std::atoi(value);
+			else if(arg == "--seed")
+				opts.mSeed = (uint32_t)std::strtoul(value, 0, 10);
+			else if(arg == "--search")
+				opts.mSearch = (float)std::atof(value);
+			else
+				return false;
+		}
+		if(opts.mWorkers == 0)
+			opts.mWorkers = std::max(1u, std::thread::hardware_concurrency());
+		return opts.mOut != 0;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options opts;
+	if(!ParseArgs(argc, argv, opts))
+	{
+		std::fprintf(stderr, "usage: selfplay --out file [--games n] [--rack 18|19|both] [--net file|none]\n"
+			"                [--explore e] [--shots n] [--workers n] [--seed n] [--search ms]\n");
+		return 2;
+	}
+
+	AI::NeuralNet* net = 0;
+	if(opts.mNet)
+	{
+		std::FILE *check = std::fopen(opts.mNet, "rb");
+		if(!check)
+		{
+			std::fprintf(stderr, "selfplay: cannot open %s\n", opts.mNet);
+			return 1;
+		}
+		std::fclose(check);
+		net = new AI::NeuralNet(std::string(opts.mNet));
+		if(net->InputCount() != (int)AI::kShotInputs || net->OutputCount() < 1)
+		{
+			std::fprintf(stderr, "selfplay: %s does not take %u inputs\n", opts.mNet, AI::kShotInputs);
+			return 1;
+		}
+	}
+
+	std::FILE *out = std::fopen(opts.mOut, "wb");
+	if(!out)
+	{
+		std::fprintf(stderr, "selfplay: cannot write %s\n", opts.mOut);
+		return 1;
+	}
+	AI::ShotLogHeader header = { AI::kShotLogMagic, AI::kShotLogVersion, AI::kShotInputs, AI::kShotOutputs };
+	std::fwrite(&header, sizeof(header), 1, out);
+
+	Physics::JobPool jobs;
+	jobs.Workers(opts.mWorkers);
+	const uint32_t block = opts.mWorkers * kGamesPerWorker;
+	std::vector< std::vector< float > > records(block);
+	std::vector< GameStats > stats(block);
+	GameStats total;
+
+	Clock::time_point t0 = Clock::now();
+	for(uint32_t first = 0; first < opts.mGames; first += block)
+	{
+		uint32_t count = std::min(block, opts.mGames - first);
+		Physics::JobPool::RangeFn play = [&](uint32_t begin, uint32_t end)
+		{
+			for(uint32_t g = begin; g < end; ++g)
+			{
+				records[g].clear();
+				stats[g] = GameStats();
+				Match match(opts, net, first + g);
+				match.Play(records[g], stats[g]);
+			}
+		};
+		jobs.ParallelFor(count, 1, play);
+
+		// in game order, so the log does not depend on which worker finished first
+		for(uint32_t g = 0; g < count; ++g)
+		{
+			if(!records[g].empty())
+				std::fwrite(&records[g][0], sizeof(float), records[g].size(), out);
+			total.Add(stats[g]);
+		}
+	}
+	double ms = Millis(t0, Clock::now());
+	bool ok = std::fclose(out) == 0;
+	delete net;
+
+	std::fprintf(stderr, "selfplay: %u games, %llu shots, %.1f%% made, %llu scratches, %llu tables cleared\n",
+		opts.mGames, (unsigned long long)total.mShots, total.mShots ? 100. * total.mMade / total.mShots : 0.,
+		(unsigned long long)total.mScratches, (unsigned long long)total.mCleared);
+	std::fprintf(stderr, "selfplay: %.1f s on %u workers, %.0f shots/s, %.0f frames/shot\n",
+		ms / 1000., opts.mWorkers, total.mShots * 1000. / std::max(ms, 1.),
+		total.mShots ? (double)total.mFrames / (total.mShots + opts.mGames) : 0.);
+	if(!ok)
+	{
+		std::fprintf(stderr, "selfplay: writing %s failed\n", opts.mOut);
+		return 1;
+	}
+	return 0;
+}
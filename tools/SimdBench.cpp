@@ -0,0 +1,398 @@
+/*!
+	@file	SimdBench.cpp
+	@date	October 17, 2026
+
+	@brief	Times the SIMD physics kernels against plain Vector3D versions.
+
+		Usage: simdbench [bodies] [pairs]
+
+		Steps bodies (default 4096) free bodies through the integrator,
+		once with BodyStore's SIMD loops and once with the Vector3D code
+		they replaced, and checks both end in the same state bit for bit.
+		Then runs pairs (default 1000000) swept sphere-sphere tests with
+		the Vector3D code, with SweepSpheres() one pair at a time and with
+		SphereSweepBatch, and checks every hit, time and normal matches.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "BodyStore.h"
+#include "SimdVector.h"
+#include "SphereKernels.h"
+#include "TableSetup.h"
+
+using Physics::BodyStore;
+using Collision::SphereSweep;
+using TableSetup::Clock;
+using TableSetup::Lcg;
+using TableSetup::Millis;
+
+namespace
+{
+	const Real		kStep		= .01f;
+	const Vector3D	kGravity(0.f, -9.8f, 0.f);
+	const Real		kMaxLinVel	= 100.f;
+	const Real		kMaxAngVel	= 30.f;
+	const Real		kMaxAngMom	= 30.f;
+
+	void Hash(uint64_t &hash, const void* data, std::size_t bytes)
+	{
+		const uint8_t* p = static_cast< const uint8_t* >(data);
+		for(std::size_t i = 0; i < bytes; ++i)
+			hash = (hash ^ p[i]) * 1099511628211ull;
+	}
+
+	// ---------------------------------------------------------------------
+	// The integrator as it was written against Vector3D, for reference.
+	// ---------------------------------------------------------------------
+
+	void ScalarCapVectorNorm(Vector3D &v, float max)
+	{
+		if(v.length() > max)
+			v = max * v.normal();
+	}
+
+	void ScalarReset(BodyStore &s, uint32_t begin, uint32_t end)
+	{
+		for(uint32_t i = begin; i < end; ++i)
+		{
+			uint8_t flags = s.mFlags[i];
+			if(!(flags & BodyStore::kF_Active))
+				continue;
+
+			s.mOrientationT0[i]	= s.mOrientationT1[i];
+			s.mPositionT0[i]	= s.mPositionT1[i];
+			s.mVelocityT0[i]	= s.mVelocityT1[i];
+			s.mAngVelocityT0[i]	= s.mAngVelocityT1[i];
+			s.mAngMomentumT0[i]	= s.mAngMomentumT1[i];
+
+			if(flags & BodyStore::kF_Translatable)
+			{
+				if(flags & BodyStore::kF_Collided)
+				{
+					s.mForce[i] += (Real(-0.95) * s.mVelocityT0[i].length()) * s.mVelocityT0[i];
+				}
+				else
+				{
+					Real forceSquared = (Real)(s.mForce[i] * s.mForce[i]);
+					if(forceSquared < kEpsilon)
+						s.mVelocityT0[i] *= s.mLinDamp[i];
+				}
+			}
+
+			if(flags & BodyStore::kF_Spinnable)
+			{
+				Real aDamp = -s.mMass[i];
+				s.mTorque[i] = aDamp * s.mAngVelocityT0[i].normal();
+			}
+
+			s.mFlags[i] = flags & ~BodyStore::kF_Collided;
+		}
+	}
+
+	void ScalarIntegrate1(BodyStore &s, Real dt, uint32_t begin, uint32_t end)
+	{
+		for(uint32_t i = begin; i < end; ++i)
+		{
+			uint8_t flags = s.mFlags[i];
+			if(!(flags & BodyStore::kF_Active))
+				continue;
+
+			if(flags & BodyStore::kF_Translatable)
+			{
+				Real massInv = s.mMassInv[i];
+				Vector3D A = s.mForce[i] * massInv;
+				Vector3D F;
+				Vector3D k1, k2, k3, k4;
+
+				k1 = A * dt;
+				F = F + k1 * .5f;
+				A = F * massInv;
+				k2 = A * dt;
+				F = F + k2 * .5f;
+				A = F * massInv;
+				k3 = A * dt;
+				F = F + k3;
+				A = F * massInv;
+				k4 = A * dt;
+
+				s.mVelocityT1[i] += (k1 + k2 + k3 + k4) * (1.f/6.f);
+				s.mPositionT1[i] += dt * s.mVelocityT1[i];
+			}
+			if(flags & BodyStore::kF_Spinnable)
+			{
+				Real inertiaInv = s.mInertiaInv[i][0];
+				Vector3D A = s.mTorque[i] * inertiaInv;
+				Vector3D F;
+				Vector3D k1, k2, k3, k4;
+
+				k1 = A * dt;
+				F = F + k1 * .5f;
+				A = F * inertiaInv;
+				k2 = A * dt;
+				F = F + k2 * .5f;
+				A = F * inertiaInv;
+				k3 = A * dt;
+				F = F + k3;
+				A = F * inertiaInv;
+				k4 = A * dt;
+
+				s.mAngVelocityT1[i] += (k1 + k2 + k3 + k4) * (1.f/6.f);
+				Quaternion q = s.mOrientationT1[i];
+				q.Normalize();
+				s.mOrientationT1[i] += q * s.mAngVelocityT1[i].normal() * static_cast< float >(kHalf * dt);
+				s.mOrientationT1[i].Normalize();
+			}
+		}
+	}
+
+	void ScalarIntegrate2(BodyStore &s, Real dt, uint32_t begin, uint32_t end)
+	{
+		for(uint32_t i = begin; i < end; ++i)
+		{
+			uint8_t flags = s.mFlags[i];
+			if(!(flags & BodyStore::kF_Active))
+				continue;
+
+			if(flags & BodyStore::kF_Translatable)
+			{
+				Vector3D accel = s.mMassInv[i] * s.mForce[i];
+				if(flags & BodyStore::kF_Gravity)
+					accel += kGravity;
+
+				s.mVelocityT1[i] += (dt * kHalf) * accel;
+				s.mForce[i] = Vector3D();
+			}
+
+			if(flags & BodyStore::kF_Spinnable)
+			{
+				s.mAngMomentumT1[i] += (dt * kHalf) * s.mTorque[i].normal();
+				s.mTorque[i] = Vector3D();
+			}
+			ScalarCapVectorNorm(s.mVelocityT1[i], kMaxLinVel);
+			ScalarCapVectorNorm(s.mAngVelocityT1[i], kMaxAngVel);
+			ScalarCapVectorNorm(s.mAngMomentumT1[i], kMaxAngMom);
+		}
+	}
+
+	/// The swept sphere test as CollideSphereSphere wrote it against Vector3D.
+	bool ScalarSweepSpheres(const SphereSweep &sphere1, const SphereSweep &sphere2, Real &time)
+	{
+		Vector3D va = sphere1.mPositionT1 - sphere1.mPositionT0;
+		Vector3D vb = sphere2.mPositionT1 - sphere2.mPositionT0;
+		Vector3D dv = vb - va;
+		Vector3D dp = sphere2.mPositionT0 - sphere1.mPositionT0;
+		float r = sphere1.mRadius + sphere2.mRadius;
+		float pp = dp[0] * dp[0] + dp[1] * dp[1] + dp[2] * dp[2] - r * r;
+		if(!(pp < 0))
+			return false;
+		float pv = dp[0] * dv[0] + dp[1] * dv[1] + dp[2] * dv[2];
+		if(pv >= 0)
+			return false;
+		float vv = dv[0] * dv[0] + dv[1] * dv[1] + dv[2] * dv[2];
+		if((pv + vv) <= 0 && (vv + 2 * pv + pp) >= 0)
+			return false;
+		time = -pv / vv;
+		return true;
+	}
+
+	// ---------------------------------------------------------------------
+
+	/*!
+	 @param s
+	 @param count	Number of bodies.
+
+	 Free bodies with random state; every fourth one is marked as collided
+	 and every eighth is left without force, so all the damping paths run.
+	*//*__________________________________________________________________________*/
+	void BuildBodies(BodyStore &s, uint32_t count)
+	{
+		Lcg rng(777u);
+		for(uint32_t i = 0; i < count; ++i)
+		{
+			s.Create();
+			s.mFlags[i]			= BodyStore::kF_Active | BodyStore::kF_Translatable | BodyStore::kF_Spinnable | BodyStore::kF_Gravity;
+			s.mMass[i]			= rng.Range(.25f, 2.f);
+			s.mMassInv[i]		= 1.f / s.mMass[i];
+			Real inertia		= 2.5f / s.mMass[i];
+			s.mInertiaInv[i]	= Vector3D(inertia, inertia, inertia);
+			s.mLinDamp[i]		= .99f;
+			s.mPositionT1[i]	= rng.Vector(-30.f, 30.f);
+			s.mVelocityT1[i]	= rng.Vector(-20.f, 20.f);
+			s.mAngVelocityT1[i]	= rng.Vector(-5.f, 5.f);
+		}
+	}
+
+	/// Puts the same forces on a store each step, whichever kernels run.
+	void ApplyForces(BodyStore &s, Lcg &rng)
+	{
+		for(uint32_t i = 0; i < s.Count(); ++i)
+		{
+			s.mForce[i] = (i % 8 == 0) ? Vector3D() : rng.Vector(-10.f, 10.f);
+			if(i % 4 == 1)
+				s.mFlags[i] |= BodyStore::kF_Collided;
+		}
+	}
+
+	uint64_t StoreHash(const BodyStore &s)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		std::vector< uint8_t > bytes(s.StateBytes());
+		s.SaveState(&bytes[0]);
+		Hash(hash, &bytes[0], bytes.size());
+		return hash;
+	}
+
+	/*!
+	 @param count	Number of bodies.
+	 @param steps	Number of steps to time.
+	*//*__________________________________________________________________________*/
+	void RunIntegrator(uint32_t count, int steps)
+	{
+		BodyStore scalar, simd;
+		BuildBodies(scalar, count);
+		BuildBodies(simd, count);
+
+		Physics::Params params;
+		params.mGravity		= kGravity;
+		params.mMaxLinVel	= kMaxLinVel;
+		params.mMaxAngVel	= kMaxAngVel;
+		params.mMaxAngMom	= kMaxAngMom;
+
+		double ms[2] = { 0., 0. };
+		for(int run = 0; run < 2; ++run)
+		{
+			BodyStore &s = run == 0 ? scalar : simd;
+			Lcg rng(4242u);
+			for(int i = 0; i < steps; ++i)
+			{
+				ApplyForces(s, rng);
+				Clock::time_point t0 = Clock::now();
+				if(run == 0)
+				{
+					ScalarReset(s, 0, count);
+					ScalarIntegrate1(s, kStep, 0, count);
+					ScalarIntegrate2(s, kStep, 0, count);
+				}
+				else
+				{
+					s.ResetForNextTimeStep(0, count);
+					s.Integrate1(kStep, 0, count);
+					s.Integrate2(kStep, params, 0, count);
+				}
+				ms[run] += Millis(t0, Clock::now());
+			}
+		}
+		std::printf("%-12s %9u %12.4f %12.4f %8.2f %6s\n", "integrate", count, ms[0] / steps, ms[1] / steps,
+			ms[0] / ms[1], StoreHash(scalar) == StoreHash(simd) ? "yes" : "NO");
+	}
+
+	/*!
+	 @param count	Number of sphere pairs.
+	*//*__________________________________________________________________________*/
+	void RunSphereSphere(uint32_t count)
+	{
+		// pairs a few radii apart moving a ball width or so: about a third touch
+		std::vector< SphereSweep > a(count), b(count);
+		Lcg rng(31337u);
+		for(uint32_t i = 0; i < count; ++i)
+		{
+			a[i].mPositionT0	= rng.Vector(-1.5f, 1.5f);
+			a[i].mPositionT1	= a[i].mPositionT0 + rng.Vector(-1.f, 1.f);
+			a[i].mRadius		= 1.f;
+			b[i].mPositionT0	= rng.Vector(-1.5f, 1.5f);
+			b[i].mPositionT1	= b[i].mPositionT0 + rng.Vector(-1.f, 1.f);
+			b[i].mRadius		= rng.Range(.5f, 1.5f);
+		}
+
+		// 0: Vector3D reference, 1: SweepSpheres() one pair at a time, 2: SphereSweepBatch
+		std::vector< Real > time[3];
+		std::vector< Vector3D > normal[3];
+		std::vector< uint8_t > hit[3];
+		double ms[3];
+		for(int run = 0; run < 3; ++run)
+		{
+			time[run].assign(count, 0.f);
+			normal[run].assign(count, Vector3D());
+			hit[run].assign(count, 0);
+			Clock::time_point t0 = Clock::now();
+			if(run < 2)
+			{
+				for(uint32_t i = 0; i < count; ++i)
+				{
+					if(run == 0)
+						hit[run][i] = ScalarSweepSpheres(a[i], b[i], time[run][i]);
+					else
+						hit[run][i] = Collision::SweepSpheres(a[i], b[i], time[run][i]);
+					// the narrowphase only builds a normal for a hit
+					if(hit[run][i])
+						normal[run][i] = (a[i].mPositionT1 - b[i].mPositionT1).normal();
+				}
+			}
+			else
+			{
+				Collision::SphereSweepBatch batch;
+				for(uint32_t first = 0; first < count; first += batch.Count())
+				{
+					batch.Clear();
+					for(uint32_t i = first; i < count && !batch.Full(); ++i)
+						batch.Push(a[i], b[i]);
+					batch.Run();
+					for(uint32_t lane = 0; lane < batch.Count(); ++lane)
+					{
+						if(!batch.Hit(lane))
+							continue;
+						hit[run][first + lane] = 1;
+						time[run][first + lane] = batch.Time(lane);
+						normal[run][first + lane] = batch.Normal(lane);
+					}
+				}
+			}
+			ms[run] = Millis(t0, Clock::now());
+		}
+
+		uint32_t hits = 0;
+		bool same[3] = { true, true, true };
+		for(uint32_t i = 0; i < count; ++i)
+		{
+			hits += hit[0][i];
+			for(int run = 1; run < 3; ++run)
+			{
+				if(hit[0][i] != hit[run][i])
+					same[run] = false;
+				else if(hit[0][i] && (std::memcmp(&time[0][i], &time[run][i], sizeof(Real)) != 0 ||
+									  std::memcmp(&normal[0][i], &normal[run][i], sizeof(Vector3D)) != 0))
+					same[run] = false;
+			}
+		}
+		std::printf("%-12s %9u %12.4f %12.4f %8.2f %6s %8u\n", "sphere1", count, ms[0], ms[1], ms[0] / ms[1],
+			same[1] ? "yes" : "NO", hits);
+		std::printf("%-12s %9u %12.4f %12.4f %8.2f %6s %8u\n", "spherebatch", count, ms[0], ms[2], ms[0] / ms[2],
+			same[2] ? "yes" : "NO", hits);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t bodies = argc > 1 ? (uint32_t)std::atoi(argv[1]) : 4096;
+	uint32_t pairs = argc > 2 ? (uint32_t)std::atoi(argv[2]) : 1000000;
+
+#if defined( CH_SIMD_SSE2 ) && defined( __AVX2__ )
+	std::printf("vector kernels: SSE2, AVX2 encoding\n\n");
+#elif defined( CH_SIMD_SSE2 )
+	std::printf("vector kernels: SSE2\n\n");
+#else
+	std::printf("vector kernels: plain C++\n\n");
+#endif
+	std::printf("%-12s %9s %12s %12s %8s %6s %8s\n", "kernel", "count", "scalar_ms", "simd_ms", "speedup", "same", "hits");
+	for(uint32_t n = 256; n <= bodies; n *= 4)
+		RunIntegrator(n, 200);
+	RunSphereSphere(pairs);
+	return 0;
+}
@@ -0,0 +1,250 @@
+/*!
+	@file	TableSetup.h
+	@date	October 17, 2026
+
+	@brief	The game's table and racks, built headless for the tools.
+
+		Walls, pockets and balls are made the way PlayfieldBase and
+		Playfield::RackBalls make them, with the sizes in internal.ini, so
+		every tool times and plays on the same table as the game. The
+		benchmarks' larger scenes, fields of loose spheres in a table grown
+		to fit them, are built here too.
+
+ (c) DigiPen (USA) Corporation, all rights reserved.
+ *//*__________________________________________________________________________*/
+
+#pragma once
+
+#ifndef	__TABLESETUP_H__
+#define	__TABLESETUP_H__
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Physics.h"
+#include "PhysicsAux.h"
+
+namespace TableSetup
+{
+	typedef std::chrono::steady_clock Clock;
+
+	const Real kHalfWidth	= 25.f;		///< Playfield is 50 x 25 x 75, as in internal.ini.
+	const Real kHalfHeight	= 12.5f;
+	const Real kHalfDepth	= 37.5f;
+	const Real kBallRadius	= 1.f;
+	const Real kPocketSize	= 6.f;
+	const Real kSubstep		= .01f;		///< Update(.05, 5) hands Simulate .01 at a time.
+	const Real kFrameTime	= .05f;		///< The game loop's Update(.05, 5).
+	const int  kSubsteps	= 5;
+	const int  kMaxFrames	= 5000;		///< Same cut-off as ShotBatch.
+
+	inline double Millis(Clock::time_point t0, Clock::time_point t1)
+	{
+		return std::chrono::duration< double, std::milli >(t1 - t0).count();
+	}
+
+	/// Small deterministic generator, so a seed always builds the same scene or trains the same net.
+	struct Lcg
+	{
+		explicit Lcg(uint32_t seed) : mState(seed) {}
+		uint32_t Next(void)
+		{
+			mState = mState * 1664525u + 1013904223u;
+			return mState;
+		}
+		Real Float(void)					{ return (Real)(Next() >> 8) / (Real)(1 << 24); }
+		Real Range(Real lo, Real hi)		{ return lo + (hi - lo) * Float(); }
+		uint32_t Below(uint32_t n)			{ return (uint32_t)(((uint64_t)(Next() >> 8) * n) >> 24); }
+		/// Each component in [lo, hi), drawn x, y, z in that order.
+		Vector3D Vector(Real lo, Real hi)	{ Real x = Range(lo, hi), y = Range(lo, hi); return Vector3D(x, y, Range(lo, hi)); }
+		uint32_t mState;
+	};
+
+	/// The engine's ids of a table's pockets, and the corner point of each.
+	struct Pockets
+	{
+		std::vector< uint32_t >				mIds;
+		std::vector< Geometry::Point3D >	mCorners;
+	};
+
+	/*!
+	 @param e
+	 @param cx	The corner of the box the pocket cuts off.
+	 @param cy
+	 @param cz
+	 @param size	How far along each wall the pocket reaches.
+	 @param pockets	Receives the pocket, if not 0.
+	*//*__________________________________________________________________________*/
+	inline void AddPocket(Physics::Engine &e, Real cx, Real cy, Real cz, Real size, Pockets* pockets = 0)
+	{
+		Real x = cx > 0 ? -size : size;
+		Real y = cy > 0 ? -size : size;
+		Real z = cz > 0 ? -size : size;
+		Physics::BoundedPlane bp(Geometry::Point3D(cx + x, cy, cz), Geometry::Point3D(cx, cy + y, cz), Geometry::Point3D(cx, cy, cz + z));
+		uint32_t id = e.AddRigidBodyBoundedPlane(bp);
+		e.RigidBodyBool(id, Physics::Engine::propCollidable, true);
+		e.RigidBodyBool(id, Physics::Engine::propActive, true);
+		if(pockets)
+		{
+			pockets->mIds.push_back(id);
+			pockets->mCorners.push_back(Geometry::Point3D(cx, cy, cz));
+		}
+	}
+
+	/*!
+	 @param e
+	 @param hw	Half width of the box.
+	 @param hh	Half height of the box.
+	 @param hd	Half depth of the box.
+	 @param pockets	Receives the pockets, if not 0.
+
+	 Six walls and a pocket in each corner, as PlayfieldBase builds them.
+	 The walls are the first six bodies.
+	*//*__________________________________________________________________________*/
+	inline void AddTable(Physics::Engine &e, Real hw, Real hh, Real hd, Pockets* pockets = 0)
+	{
+		Geometry::Plane3D walls[6] =
+		{
+			Geometry::Plane3D(0, -1, 0, hh), Geometry::Plane3D(0, 1, 0, hh),
+			Geometry::Plane3D(-1, 0, 0, hw), Geometry::Plane3D(1, 0, 0, hw),
+			Geometry::Plane3D(0, 0, -1, hd), Geometry::Plane3D(0, 0, 1, hd)
+		};
+		for(int i = 0; i < 6; ++i)
+		{
+			uint32_t id = e.AddRigidBodyPlane(walls[i]);
+			e.RigidBodyBool(id, Physics::Engine::propCollidable, true);
+			e.RigidBodyBool(id, Physics::Engine::propActive, true);
+		}
+		for(int sx = -1; sx <= 1; sx += 2)
+			for(int sy = -1; sy <= 1; sy += 2)
+				for(int sz = -1; sz <= 1; sz += 2)
+					AddPocket(e, sx * hw, sy * hh, sz * hd, kPocketSize, pockets);
+	}
+
+	/// The game's table.
+	inline void AddTable(Physics::Engine &e, Pockets* pockets = 0)
+	{
+		AddTable(e, kHalfWidth, kHalfHeight, kHalfDepth, pockets);
+	}
+
+	/// A ball as the game makes one, at rest.
+	inline uint32_t AddBall(Physics::Engine &e, const Vector3D &pos)
+	{
+		uint32_t id = e.AddRigidBodySphere(kBallRadius);
+		e.RigidBodyBool(id, Physics::Engine::propCollidable, true);
+		e.RigidBodyBool(id, Physics::Engine::propActive, true);
+		e.RigidBodyBool(id, Physics::Engine::propTranslatable, true);
+		e.RigidBodyBool(id, Physics::Engine::propUseGravity, true);
+		e.RigidBodyBool(id, Physics::Engine::propSpinnable, true);
+		e.RigidBodyScalar(id, Physics::Engine::propMass, .5f);
+		e.RigidBodyVector3D(id, Physics::Engine::propPosition, pos);
+		return id;
+	}
+
+	inline uint32_t AddBall(Physics::Engine &e, const Vector3D &pos, const Vector3D &vel)
+	{
+		uint32_t id = AddBall(e, pos);
+		e.RigidBodyVector3D(id, Physics::Engine::propVeloctity, vel);
+		return id;
+	}
+
+	/*!
+	 @param e
+	 @param count	Number of spheres.
+
+	 Spheres on a jittered lattice, 4 units apart, moving in random directions;
+	 the box grows with the count so density stays near that of a break.
+	*//*__________________________________________________________________________*/
+	inline void BuildField(Physics::Engine &e, int count)
+	{
+		int side = 1;
+		while(side * side * side * 2 < count)
+			++side;
+		// two layers deep in Z for every layer in X and Y, like the playfield
+		int nx = side, ny = side, nz = 2 * side;
+		Real spacing = 4.f;
+		Real hw = std::max(kHalfWidth, .5f * spacing * nx + 2.f);
+		Real hh = std::max(kHalfHeight, .5f * spacing * ny + 2.f);
+		Real hd = std::max(kHalfDepth, .5f * spacing * nz + 2.f);
+		AddTable(e, hw, hh, hd);
+
+		Lcg rng(1234u);
+		int made = 0;
+		for(int z = 0; z < nz && made < count; ++z)
+			for(int y = 0; y < ny && made < count; ++y)
+				for(int x = 0; x < nx && made < count; ++x, ++made)
+				{
+					Vector3D pos((x - .5f * (nx - 1)) * spacing + rng.Range(-.5f, .5f),
+								 (y - .5f * (ny - 1)) * spacing + rng.Range(-.5f, .5f),
+								 (z - .5f * (nz - 1)) * spacing + rng.Range(-.5f, .5f));
+					Vector3D vel(rng.Range(-20.f, 20.f), rng.Range(-20.f, 20.f), rng.Range(-20.f, 20.f));
+					AddBall(e, pos, vel);
+				}
+	}
+
+	/// The narrowphase pools its contacts; big scenes need a bigger pool.
+	inline void ReserveContacts(Physics::Engine &e)
+	{
+		e.mAuxEngine->mCollisionEngine.SetCapacity(std::max(2048, (int)e.mAuxEngine->mBodies.Count() * 4));
+	}
+
+	// Playfield::RackBalls spacing for the 18-ball pyramid.
+	const Real kRackGap		= 1.2f;
+	const Real kRackDs		= std::tan(Math::DegToRad(30.f));
+	const Real kRackDl		= std::tan(Math::DegToRad(60.f)) - std::tan(Math::DegToRad(30.f));
+
+	inline void BuildRow(std::vector< Vector3D > &balls, int n, Vector3D p)
+	{
+		for(int i = 0; i < n; ++i)
+		{
+			balls.push_back(p);
+			p[0] += 2 * kRackGap + .1f;
+		}
+	}
+
+	inline Vector3D BuildLayer(std::vector< Vector3D > &balls, int n, Vector3D last)
+	{
+		Vector3D ret = last;
+		for(int i = n; i > 0; --i)
+		{
+			BuildRow(balls, i, last);
+			last[0] += kRackGap;
+			last[1] -= kRackDl + kRackDs;
+		}
+		ret[0] -= kRackGap;
+		ret[1] += kRackDs;
+		ret[2] += std::sqrt(3.f) * kRackGap - .1f;
+		return ret;
+	}
+
+	/// The 18-ball game's five-level pyramid of 35 object balls.
+	inline void Rack18(std::vector< Vector3D > &balls)
+	{
+		Vector3D org(0, 0, 25);
+		for(int i = 1; i <= 5; ++i)
+			org = BuildLayer(balls, i, org);
+	}
+
+	/// The 19-ball diamond.
+	inline void Rack19(std::vector< Vector3D > &balls)
+	{
+		balls.push_back(Vector3D(0, 0, 25));
+		Real z = 25.f, dz = std::sqrt(3.f);
+		z += dz;
+		balls.push_back(Vector3D(-1, 1, z)); balls.push_back(Vector3D(1, 1, z));
+		balls.push_back(Vector3D(-1, -1, z)); balls.push_back(Vector3D(1, -1, z));
+		z += dz;
+		for(int a = -2; a <= 2; a += 2)
+			for(int c = 2; c >= -2; c -= 2)
+				balls.push_back(Vector3D((Real)a, (Real)c, z));
+		z += dz;
+		balls.push_back(Vector3D(-1, 1, z)); balls.push_back(Vector3D(1, 1, z));
+		balls.push_back(Vector3D(-1, -1, z)); balls.push_back(Vector3D(1, -1, z));
+		z += dz;
+		balls.push_back(Vector3D(0, 0, z));
+	}
+}
+
+#endif